@@ -621,3 +621,350 @@ audit_record::audit_record(const char *name, media_type type)
 		m_shared_device(NULL)
 {
 }
+
+
+
+//**************************************************************************
+//  AUDIT CACHE
+//**************************************************************************
+
+// name of the file results are kept in
+static const char audit_cache_filename[] = "verifyroms.cache";
+
+// how much of the end of each archive goes into a signature; this covers
+// the central directory of a zip and the header of a 7z
+#define AUDIT_CACHE_TAIL_SIZE   65536
+
+
+//-------------------------------------------------
+//  escape_output - make summary text safe to
+//  store on a single line
+//-------------------------------------------------
+
+static void escape_output(astring &dest, const char *src)
+{
+	dest.reset();
+	for ( ; *src != 0; src++)
+	{
+		if (*src == '\\')
+			dest.cat("\\\\");
+		else if (*src == '\n')
+			dest.cat("\\n");
+		else if (*src == '\t')
+			dest.cat("\\t");
+		else
+			dest.cat(src, 1);
+	}
+}
+
+
+//-------------------------------------------------
+//  unescape_output - undo escape_output
+//-------------------------------------------------
+
+static void unescape_output(astring &dest, const char *src, const char *end)
+{
+	dest.reset();
+	for ( ; src < end; src++)
+	{
+		if (*src == '\\' && src + 1 < end)
+		{
+			src++;
+			if (*src == 'n')
+				dest.cat("\n");
+			else if (*src == 't')
+				dest.cat("\t");
+			else
+				dest.cat(src, 1);
+		}
+		else
+			dest.cat(src, 1);
+	}
+}
+
+
+//-------------------------------------------------
+//  audit_cache - constructor
+//-------------------------------------------------
+
+audit_cache::audit_cache(emu_options &options)
+	: m_options(options),
+		m_enabled(options.audit_cache()),
+		m_dirty(false)
+{
+	if (m_enabled)
+		load();
+}
+
+
+//-------------------------------------------------
+//  driver_signature - compute the signature of
+//  every file the current driver could be
+//  audited from
+//-------------------------------------------------
+
+UINT32 audit_cache::driver_signature(const driver_enumerator &enumerator)
+{
+	if (!m_enabled)
+		return 0;
+
+	// gather the same names audit_media searches, without duplicates
+	astring names;
+	add_names(names, enumerator.config().root_device().searchpath());
+	device_iterator deviter(enumerator.config().root_device());
+	for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
+		if (rom_first_region(*device) != NULL)
+		{
+			add_names(names, device->searchpath());
+			if (device->shortname() != NULL)
+				add_names(names, device->shortname());
+		}
+	return compute_signature(names);
+}
+
+
+//-------------------------------------------------
+//  device_signature - compute the signature of
+//  every file a device could be audited from
+//-------------------------------------------------
+
+UINT32 audit_cache::device_signature(device_t &device)
+{
+	if (!m_enabled)
+		return 0;
+	return compute_signature(device.shortname());
+}
+
+
+//-------------------------------------------------
+//  find - return the remembered result for a set
+//  if its files still match
+//-------------------------------------------------
+
+bool audit_cache::find(const char *name, UINT32 signature, media_auditor::summary &summary, astring &output) const
+{
+	if (signature == 0)
+		return false;
+
+	entry *cached = m_map.find(name);
+	if (cached == NULL || cached->m_signature != signature)
+		return false;
+
+	summary = cached->m_summary;
+	output = cached->m_output;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  add - remember the result of an audit
+//-------------------------------------------------
+
+void audit_cache::add(const char *name, UINT32 signature, media_auditor::summary summary, const char *output)
+{
+	if (signature == 0)
+		return;
+
+	entry *cached = m_map.find(name);
+	if (cached != NULL)
+	{
+		cached->m_signature = signature;
+		cached->m_summary = summary;
+		cached->m_output.cpy(output);
+	}
+	else
+		m_map.add(name, &m_list.append(*global_alloc(entry(name, signature, summary, output))));
+	m_dirty = true;
+}
+
+
+//-------------------------------------------------
+//  save - write the results back out if anything
+//  changed
+//-------------------------------------------------
+
+void audit_cache::save()
+{
+	if (!m_enabled || !m_dirty)
+		return;
+
+	emu_file file(m_options.cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(audit_cache_filename) != FILERR_NONE)
+	{
+		mame_printf_verbose("Unable to write %s\n", audit_cache_filename);
+		return;
+	}
+
+	// the first line ties the results to this exact build
+	file.printf("%s %s\n", build_version, build_stamp);
+
+	astring escaped;
+	for (entry *cached = m_list.first(); cached != NULL; cached = cached->next())
+	{
+		escape_output(escaped, cached->m_output);
+		file.printf("%s\t%08X\t%d\t%s\n", cached->m_name.cstr(), cached->m_signature, (int)cached->m_summary, escaped.cstr());
+	}
+	m_dirty = false;
+}
+
+
+//-------------------------------------------------
+//  load - read results from a previous run
+//-------------------------------------------------
+
+void audit_cache::load()
+{
+	emu_file file(m_options.cache_directory(), OPEN_FLAG_READ);
+	if (file.open(audit_cache_filename) != FILERR_NONE)
+		return;
+
+	UINT32 size = file.size();
+	dynamic_buffer buffer(size);
+	if (size == 0 || file.read(buffer, size) != size)
+		return;
+
+	// the results are only good for the build that produced them
+	astring build(build_version, " ", build_stamp);
+	const char *cur = reinterpret_cast<const char *>(&buffer[0]);
+	const char *end = cur + size;
+	const char *eol = (const char *)memchr(cur, '\n', end - cur);
+	if (eol == NULL || build.len() != eol - cur || strncmp(cur, build, eol - cur) != 0)
+		return;
+
+	astring name, output;
+	for (cur = eol + 1; cur < end; cur = eol + 1)
+	{
+		eol = (const char *)memchr(cur, '\n', end - cur);
+		if (eol == NULL)
+			break;
+
+		// split into name, signature, summary and output
+		const char *field[4];
+		int fields = 1;
+		field[0] = cur;
+		for (const char *scan = cur; scan < eol && fields < 4; scan++)
+			if (*scan == '\t')
+				field[fields++] = scan + 1;
+		if (fields != 4)
+			continue;
+
+		UINT32 signature;
+		int summary;
+		if (sscanf(field[1], "%08X", &signature) != 1 || sscanf(field[2], "%d", &summary) != 1 || summary < media_auditor::CORRECT || summary > media_auditor::NOTFOUND)
+			continue;
+
+		name.cpy(field[0], field[1] - 1 - field[0]);
+		unescape_output(output, field[3], eol);
+		if (m_map.find(name) == NULL)
+			m_map.add(name, &m_list.append(*global_alloc(entry(name, signature, media_auditor::summary(summary), output))));
+	}
+}
+
+
+//-------------------------------------------------
+//  add_names - add each name from a search path
+//  that isn't already in the list
+//-------------------------------------------------
+
+void audit_cache::add_names(astring &names, const char *searchpath) const
+{
+	path_iterator path(searchpath);
+	astring curname, existing;
+	while (path.next(curname))
+	{
+		bool found = false;
+		path_iterator scan(names);
+		while (!found && scan.next(existing))
+			found = (existing == curname);
+		if (!found)
+		{
+			if (names.len() != 0)
+				names.cat(";");
+			names.cat(curname);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  compute_signature - combine the size and tail
+//  of every archive each name could be loaded
+//  from across the media path
+//-------------------------------------------------
+
+UINT32 audit_cache::compute_signature(const char *names)
+{
+	static const char *const suffixes[] = { "", ".zip", ".7z" };
+
+	crc32_creator crc;
+	path_iterator namepath(names);
+	astring name, fullpath;
+	while (namepath.next(name))
+	{
+		path_iterator mediapath(m_options.media_path());
+		astring base;
+		while (mediapath.next(base, name))
+			for (int suffix = 0; suffix < ARRAY_LENGTH(suffixes); suffix++)
+			{
+				fullpath.cpy(base).cat(suffixes[suffix]);
+				crc.append(fullpath.cstr(), fullpath.len() + 1);
+
+				const path_entry &info = examine_path(fullpath);
+				if (!info.m_exists)
+					continue;
+				if (!info.m_cacheable)
+					return 0;
+				crc.append(&info.m_length, sizeof(info.m_length));
+				crc.append(&info.m_tailcrc, sizeof(info.m_tailcrc));
+			}
+	}
+
+	// reserve 0 for "not cacheable"
+	UINT32 result = crc.finish();
+	return (result != 0) ? result : 1;
+}
+
+
+//-------------------------------------------------
+//  examine_path - stat a media path and hash the
+//  tail of the file there; parents and BIOSes are
+//  shared by many sets, so each path is only read
+//  once per run
+//-------------------------------------------------
+
+const audit_cache::path_entry &audit_cache::examine_path(const char *fullpath)
+{
+	path_entry *info = m_path_map.find(fullpath);
+	if (info != NULL)
+		return *info;
+	info = &m_path_list.append(*global_alloc(path_entry(fullpath)));
+	m_path_map.add(fullpath, info);
+
+	osd_directory_entry *dirent = osd_stat(fullpath);
+	if (dirent == NULL)
+		return *info;
+	osd_dir_entry_type type = dirent->type;
+	info->m_exists = true;
+	info->m_length = dirent->size;
+	osd_free(dirent);
+
+	// loose files in a directory aren't tracked; always audit those
+	if (type != ENTTYPE_FILE)
+		return *info;
+
+	// the tail changes whenever the contents of an archive do
+	core_file *file;
+	if (core_fopen(fullpath, OPEN_FLAG_READ, &file) != FILERR_NONE)
+		return *info;
+	UINT32 taillength = MIN(info->m_length, AUDIT_CACHE_TAIL_SIZE);
+	dynamic_buffer tail(taillength);
+	core_fseek(file, info->m_length - taillength, SEEK_SET);
+	UINT32 actual = core_fread(file, tail, taillength);
+	core_fclose(file);
+	if (actual != taillength)
+		return *info;
+
+	info->m_tailcrc = crc32_creator::simple(tail, taillength);
+	info->m_cacheable = true;
+	return *info;
+}
@@ -195,4 +195,93 @@ private:
 };
 
 
+// ======================> audit_cache
+
+// remembers -verifyroms results between runs, keyed on the state of the
+// archives and files each set would be loaded from
+class audit_cache
+{
+public:
+	// construction/destruction
+	audit_cache(emu_options &options);
+
+	// signatures; 0 means the set can't be cached
+	UINT32 driver_signature(const driver_enumerator &enumerator);
+	UINT32 device_signature(device_t &device);
+
+	// operations
+	bool find(const char *name, UINT32 signature, media_auditor::summary &summary, astring &output) const;
+	void add(const char *name, UINT32 signature, media_auditor::summary summary, const char *output);
+	void save();
+
+private:
+	// a single remembered result
+	class entry
+	{
+		friend class simple_list<entry>;
+
+	public:
+		// construction/destruction
+		entry(const char *name, UINT32 signature, media_auditor::summary summary, const char *output)
+			: m_next(NULL),
+				m_name(name),
+				m_signature(signature),
+				m_summary(summary),
+				m_output(output) { }
+
+		// getters
+		entry *next() const { return m_next; }
+
+		// internal state
+		entry *                 m_next;
+		astring                 m_name;
+		UINT32                  m_signature;
+		media_auditor::summary  m_summary;
+		astring                 m_output;
+	};
+
+	// what we learned about one media path this run
+	class path_entry
+	{
+		friend class simple_list<path_entry>;
+
+	public:
+		// construction/destruction
+		path_entry(const char *path)
+			: m_next(NULL),
+				m_path(path),
+				m_exists(false),
+				m_cacheable(false),
+				m_length(0),
+				m_tailcrc(0) { }
+
+		// getters
+		path_entry *next() const { return m_next; }
+
+		// internal state
+		path_entry *            m_next;
+		astring                 m_path;
+		bool                    m_exists;       // something is at this path
+		bool                    m_cacheable;    // it is a file whose tail we could read
+		UINT64                  m_length;
+		UINT32                  m_tailcrc;
+	};
+
+	// internal helpers
+	void load();
+	void add_names(astring &names, const char *searchpath) const;
+	UINT32 compute_signature(const char *names);
+	const path_entry &examine_path(const char *fullpath);
+
+	// internal state
+	emu_options &               m_options;
+	bool                        m_enabled;
+	bool                        m_dirty;
+	simple_list<entry>          m_list;
+	tagmap_t<entry *, 6151>     m_map;
+	simple_list<path_entry>     m_path_list;
+	tagmap_t<path_entry *, 6151> m_path_map;
+};
+
+
 #endif  /* __AUDIT_H__ */
@@ -782,12 +782,23 @@ void cli_frontend::verifyroms(const char *gamename)
 
 	// iterate over drivers
 	media_auditor auditor(drivlist);
+	audit_cache cache(m_options);
 	while (drivlist.next())
 	{
 		matched++;
 
-		// audit the ROMs in this set
-		media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
+		// audit the ROMs in this set, unless a previous run already did so
+		// against the same files
+		media_auditor::summary summary;
+		astring summary_string;
+		UINT32 signature = cache.driver_signature(drivlist);
+		if (!cache.find(drivlist.driver().name, signature, summary, summary_string))
+		{
+			summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
+			if (summary != media_auditor::NOTFOUND)
+				auditor.summarize(drivlist.driver().name, &summary_string);
+			cache.add(drivlist.driver().name, signature, summary, summary_string);
+		}
 
 		// if not found, count that and leave it at that
 		if (summary == media_auditor::NOTFOUND)
@@ -797,8 +808,6 @@ void cli_frontend::verifyroms(const char *gamename)
 		else
 		{
 			// output the summary of the audit
-			astring summary_string;
-			auditor.summarize(drivlist.driver().name,&summary_string);
 			mame_printf_info("%s", summary_string.cstr());
 
 			// output the name of the driver and its clone
@@ -845,8 +854,18 @@ void cli_frontend::verifyroms(const char *gamename)
 				{
 					matched++;
 
-					// audit the ROMs in this set
-					media_auditor::summary summary = auditor.audit_device(dev, AUDIT_VALIDATE_FAST);
+					// audit the ROMs in this set, unless a previous run already did so
+					// against the same files
+					media_auditor::summary summary;
+					astring summary_string;
+					UINT32 signature = cache.device_signature(*dev);
+					if (!cache.find(dev->shortname(), signature, summary, summary_string))
+					{
+						summary = auditor.audit_device(dev, AUDIT_VALIDATE_FAST);
+						if (summary != media_auditor::NOTFOUND)
+							auditor.summarize(dev->shortname(), &summary_string);
+						cache.add(dev->shortname(), signature, summary, summary_string);
+					}
 
 					// if not found, count that and leave it at that
 					if (summary == media_auditor::NOTFOUND)
@@ -855,8 +874,6 @@ void cli_frontend::verifyroms(const char *gamename)
 					else if (summary != media_auditor::NONE_NEEDED)
 					{
 						// output the summary of the audit
-						astring summary_string;
-						auditor.summarize(dev->shortname(),&summary_string);
 						mame_printf_info("%s", summary_string.cstr());
 
 						// display information about what we discovered
@@ -910,8 +927,18 @@ void cli_frontend::verifyroms(const char *gamename)
 						matched++;
 						if (dev->rom_region() != NULL)
 						{
-							// audit the ROMs in this set
-							media_auditor::summary summary = auditor.audit_device(dev, AUDIT_VALIDATE_FAST);
+							// audit the ROMs in this set, unless a previous run already did so
+							// against the same files
+							media_auditor::summary summary;
+							astring summary_string;
+							UINT32 signature = cache.device_signature(*dev);
+							if (!cache.find(dev->shortname(), signature, summary, summary_string))
+							{
+								summary = auditor.audit_device(dev, AUDIT_VALIDATE_FAST);
+								if (summary != media_auditor::NOTFOUND)
+									auditor.summarize(dev->shortname(), &summary_string);
+								cache.add(dev->shortname(), signature, summary, summary_string);
+							}
 
 							// if not found, count that and leave it at that
 							if (summary == media_auditor::NOTFOUND)
@@ -921,8 +948,6 @@ void cli_frontend::verifyroms(const char *gamename)
 							else if(summary != media_auditor::NONE_NEEDED)
 							{
 								// output the summary of the audit
-								astring summary_string;
-								auditor.summarize(dev->shortname(),&summary_string);
 								mame_printf_info("%s", summary_string.cstr());
 
 								// display information about what we discovered
@@ -960,8 +985,9 @@ void cli_frontend::verifyroms(const char *gamename)
 		}
 	}
 
-	// clear out any cached files
+	// clear out any cached files and remember what we found
 	zip_file_cache_clear();
+	cache.save();
 
 	// return an error if none found
 	if (matched == 0)
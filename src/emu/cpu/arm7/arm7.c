@@ -580,69 +580,9 @@ static CPU_EXECUTE( arm7 )
 
 			insn = cpustate->direct->read_decrypted_dword(raddr);
 
-			/* process condition codes for this instruction */
-			switch (insn >> INSN_COND_SHIFT)
-			{
-				case COND_EQ:
-					if (Z_IS_CLEAR(GET_CPSR))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_NE:
-					if (Z_IS_SET(GET_CPSR))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_CS:
-					if (C_IS_CLEAR(GET_CPSR))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_CC:
-					if (C_IS_SET(GET_CPSR))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_MI:
-					if (N_IS_CLEAR(GET_CPSR))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_PL:
-					if (N_IS_SET(GET_CPSR))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_VS:
-					if (V_IS_CLEAR(GET_CPSR))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_VC:
-					if (V_IS_SET(GET_CPSR))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_HI:
-					if (C_IS_CLEAR(GET_CPSR) || Z_IS_SET(GET_CPSR))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_LS:
-					if (C_IS_SET(GET_CPSR) && Z_IS_CLEAR(GET_CPSR))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_GE:
-					if (!(GET_CPSR & N_MASK) != !(GET_CPSR & V_MASK)) /* Use x ^ (x >> ...) method */
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_LT:
-					if (!(GET_CPSR & N_MASK) == !(GET_CPSR & V_MASK))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_GT:
-					if (Z_IS_SET(GET_CPSR) || (!(GET_CPSR & N_MASK) != !(GET_CPSR & V_MASK)))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_LE:
-					if (Z_IS_CLEAR(GET_CPSR) && (!(GET_CPSR & N_MASK) == !(GET_CPSR & V_MASK)))
-						{ UNEXECUTED();  goto skip_exec; }
-					break;
-				case COND_NV:
-					{ UNEXECUTED();  goto skip_exec; }
-					break;
-			}
+			/* process condition codes for this instruction; COND_NV never passes */
+			if (!(arm7_cond_pass[GET_CPSR >> 28] & (1 << (insn >> INSN_COND_SHIFT))))
+				{ UNEXECUTED();  goto skip_exec; }
 			/*******************************************************************/
 			/* If we got here - condition satisfied, so decode the instruction */
 			/*******************************************************************/
@@ -91,6 +91,9 @@ write32_device_func arm7_coproc_do_callback;    // holder for the co processor D
 read32_device_func arm7_coproc_rt_r_callback;   // holder for the co processor Register Transfer Read Callback func.
 write32_device_func arm7_coproc_rt_w_callback;  // holder for the co processor Register Transfer Write Callback Callback func.
 
+// bit n of entry NZCV is set when condition code n passes with those flags
+static UINT16 arm7_cond_pass[16];
+
 #ifdef UNUSED_DEFINITION
 // custom dasm callback handlers for co-processor instructions
 char *(*arm7_dasm_cop_dt_callback)(arm_state *cpustate, char *pBuf, UINT32 opcode, char *pConditionCode, char *pBuf0);
@@ -128,6 +131,30 @@ static void arm7_core_init(device_t *device, const char *cpuname)
 	device->save_item(NAME(cpustate->pendingAbtP));
 	device->save_item(NAME(cpustate->pendingUnd));
 	device->save_item(NAME(cpustate->pendingSwi));
+
+	// build the condition code table
+	for (int flags = 0; flags < 16; flags++)
+	{
+		int n = (flags >> 3) & 1, z = (flags >> 2) & 1, c = (flags >> 1) & 1, v = flags & 1;
+		UINT16 pass = 0;
+
+		pass |= z << COND_EQ;
+		pass |= !z << COND_NE;
+		pass |= c << COND_CS;
+		pass |= !c << COND_CC;
+		pass |= n << COND_MI;
+		pass |= !n << COND_PL;
+		pass |= v << COND_VS;
+		pass |= !v << COND_VC;
+		pass |= (c && !z) << COND_HI;
+		pass |= (!c || z) << COND_LS;
+		pass |= (n == v) << COND_GE;
+		pass |= (n != v) << COND_LT;
+		pass |= (!z && n == v) << COND_GT;
+		pass |= (z || n != v) << COND_LE;
+		pass |= 1 << COND_AL;
+		arm7_cond_pass[flags] = pass;
+	}
 }
 
 // CPU RESET
@@ -516,7 +516,8 @@ enum
 #define SET_REGISTER(state, reg, val)  SetRegister(state, reg, val)
 #define GET_MODE_REGISTER(state, mode, reg)       GetModeRegister(state, mode, reg)
 #define SET_MODE_REGISTER(state, mode, reg, val)  SetModeRegister(state, mode, reg, val)
-#define ARM7_CHECKIRQ           arm7_check_irq_state(cpustate)
+/* only take the full exception check when something is actually pending */
+#define ARM7_CHECKIRQ           do { if (cpustate->pendingIrq | cpustate->pendingFiq | cpustate->pendingAbtD | cpustate->pendingAbtP | cpustate->pendingUnd | cpustate->pendingSwi) arm7_check_irq_state(cpustate); } while (0)
 
 extern write32_device_func arm7_coproc_do_callback;
 extern read32_device_func arm7_coproc_rt_r_callback;
@@ -2501,6 +2501,16 @@ void sh2drc_add_pcflush(device_t *device, offs_t address)
 	/* doesn't apply here */
 }
 
+void sh2drc_add_code_watch(device_t *device, offs_t start, offs_t end)
+{
+	/* doesn't apply here */
+}
+
+void sh2drc_code_written(device_t *device, offs_t address)
+{
+	/* doesn't apply here */
+}
+
 DEFINE_LEGACY_CPU_DEVICE(SH1, sh1);
 DEFINE_LEGACY_CPU_DEVICE(SH2, sh2);
 
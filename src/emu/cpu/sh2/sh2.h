@@ -86,5 +86,7 @@ void sh2_set_frt_input(device_t *device, int state);
 
 void sh2drc_set_options(device_t *device, UINT32 options);
 void sh2drc_add_pcflush(device_t *device, offs_t address);
+void sh2drc_add_code_watch(device_t *device, offs_t start, offs_t end);
+void sh2drc_code_written(device_t *device, offs_t address);
 
 #endif /* __SH2_H__ */
@@ -90,6 +90,16 @@ do {                                            \
 		sh2_exception(sh2,message,irq);         \
 } while(0)
 
+#ifdef USE_SH2DRC
+/* a region of writable memory whose code blocks are invalidated by page write counters */
+struct sh2_code_watch
+{
+	offs_t      start;                  /* first watched address */
+	offs_t      end;                    /* last watched address */
+	UINT32 *    version;                /* write counter for each page */
+};
+#endif
+
 struct sh2_state
 {
 	UINT32  ppc;
@@ -161,6 +171,10 @@ struct sh2_state
 	/* internal stuff */
 	UINT8               cache_dirty;                /* true if we need to flush the cache */
 
+	/* self-modifying code tracking */
+	int                 watchsel;                   /* number of watch regions */
+	sh2_code_watch      watch[4];                   /* regions reported through sh2drc_code_written */
+
 	/* parameters for subroutines */
 	UINT64              numcycles;              /* return value from gettotalcycles */
 	UINT32              arg0;                   /* print_debug argument 1 */
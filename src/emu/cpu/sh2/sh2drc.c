@@ -68,6 +68,9 @@ using namespace uml;
 #define COMPILE_MAX_INSTRUCTIONS        ((COMPILE_BACKWARDS_BYTES/2) + (COMPILE_FORWARDS_BYTES/2))
 #define COMPILE_MAX_SEQUENCE            64
 
+/* granularity of the write counters in code watch regions */
+#define CODE_WATCH_PAGE_SHIFT           8
+
 /* exit codes */
 #define EXECUTE_OUT_OF_CYCLES           0
 #define EXECUTE_MISSING_CODE            1
@@ -107,6 +110,7 @@ static void static_generate_memory_accessor(sh2_state *sh2, int size, int iswrit
 
 static void generate_update_cycles(sh2_state *sh2, drcuml_block *block, compiler_state *compiler, parameter param, int allow_exception);
 static void generate_checksum_block(sh2_state *sh2, drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
+static void generate_watch_check(sh2_state *sh2, drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
 static void generate_sequence_instruction(sh2_state *sh2, drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT32 ovrpc);
 static void generate_delay_slot(sh2_state *sh2, drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT32 ovrpc);
 
@@ -833,6 +837,36 @@ static CPU_RESET( sh1 )
 	sh2->cpu_type = CPU_TYPE_SH1;
 }
 
+/*-------------------------------------------------
+    code_watch_version - return the write counter
+    of the page holding an address in a code watch
+    region, or NULL if it is not watched
+-------------------------------------------------*/
+
+INLINE UINT32 *code_watch_version(sh2_state *sh2, offs_t address)
+{
+	for (int watchnum = 0; watchnum < sh2->watchsel; watchnum++)
+	{
+		sh2_code_watch &watch = sh2->watch[watchnum];
+		if (address >= watch.start && address <= watch.end)
+			return &watch.version[(address - watch.start) >> CODE_WATCH_PAGE_SHIFT];
+	}
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    code_watch_postload - a state load rewrites
+    watched memory without reporting it, so start
+    over with an empty cache
+-------------------------------------------------*/
+
+static void code_watch_postload(sh2_state *sh2)
+{
+	sh2->cache_dirty = TRUE;
+}
+
+
 /*-------------------------------------------------
     code_flush_cache - flush the cache and
     regenerate static code
@@ -979,8 +1013,11 @@ static void code_compile_block(sh2_state *sh2, UINT8 mode, offs_t pc)
 					continue;
 				}
 
-				/* validate this code block if we're not pointing into ROM */
-				if (sh2->program->get_write_ptr(seqhead->physpc) != NULL)
+				/* validate this code block if we're not pointing into ROM; watched */
+				/* regions only need to check that their pages haven't been written */
+				if (code_watch_version(sh2, seqhead->physpc) != NULL)
+					generate_watch_check(sh2, block, &compiler, seqhead, seqlast);
+				else if (sh2->program->get_write_ptr(seqhead->physpc) != NULL)
 					generate_checksum_block(sh2, block, &compiler, seqhead, seqlast);
 
 				/* label this instruction, if it may be jumped to locally */
@@ -1544,6 +1581,31 @@ static void generate_checksum_block(sh2_state *sh2, drcuml_block *block, compile
 }
 
 
+/*-------------------------------------------------
+    generate_watch_check - generate code to
+    validate a sequence in a code watch region
+    against the write counters of its pages
+-------------------------------------------------*/
+
+static void generate_watch_check(sh2_state *sh2, drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast)
+{
+	/* sequences are shorter than a page, so they touch at most two */
+	UINT32 *first = code_watch_version(sh2, seqhead->physpc);
+	UINT32 *last = code_watch_version(sh2, seqlast->physpc + seqlast->skipslots * 2 + 1);
+
+	if (LOG_UML)
+		block->append_comment("[Watch validation for %08X]", seqhead->pc);          // comment
+
+	UML_CMP(block, mem(first), *first);                                         // cmp     [first],*first
+	UML_EXHc(block, COND_NE, *sh2->nocode, epc(seqhead));                   // exne    nocode,seqhead->pc
+	if (last != NULL && last != first)
+	{
+		UML_CMP(block, mem(last), *last);                                       // cmp     [last],*last
+		UML_EXHc(block, COND_NE, *sh2->nocode, epc(seqhead));               // exne    nocode,seqhead->pc
+	}
+}
+
+
 /*-------------------------------------------------
     generate_sequence_instruction - generate code
     for a single instruction in a sequence
@@ -3163,6 +3225,54 @@ void sh2drc_set_options(device_t *device, UINT32 options)
 }
 
 
+/*-------------------------------------------------
+    sh2drc_add_code_watch - track writes to a
+    region of executable RAM; blocks compiled from
+    it are checked against per-page write counters
+    instead of checksums, so the driver must report
+    every write with sh2drc_code_written
+-------------------------------------------------*/
+
+void sh2drc_add_code_watch(device_t *device, offs_t start, offs_t end)
+{
+	sh2_state *sh2 = get_safe_token(device);
+
+	if (sh2->watchsel >= ARRAY_LENGTH(sh2->watch))
+		return;
+
+	/* the memory contents change behind our back on a state load */
+	if (sh2->watchsel == 0)
+		device->machine().save().register_postload(save_prepost_delegate(FUNC(code_watch_postload), sh2));
+
+	sh2_code_watch &watch = sh2->watch[sh2->watchsel++];
+	watch.start = start;
+	watch.end = end;
+	watch.version = auto_alloc_array_clear(device->machine(), UINT32, ((end - start) >> CODE_WATCH_PAGE_SHIFT) + 1);
+}
+
+
+/*-------------------------------------------------
+    sh2drc_code_written - note a write to a code
+    watch region, invalidating the blocks compiled
+    from the page it falls in
+-------------------------------------------------*/
+
+void sh2drc_code_written(device_t *device, offs_t address)
+{
+	sh2_state *sh2 = get_safe_token(device);
+
+	for (int watchnum = 0; watchnum < sh2->watchsel; watchnum++)
+	{
+		sh2_code_watch &watch = sh2->watch[watchnum];
+		if (address >= watch.start && address <= watch.end)
+		{
+			watch.version[(address - watch.start) >> CODE_WATCH_PAGE_SHIFT]++;
+			return;
+		}
+	}
+}
+
+
 /*-------------------------------------------------
     sh2drc_add_pcflush - add a new address where
     the PC must be flushed for speedups to work
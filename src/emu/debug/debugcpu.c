@@ -99,6 +99,15 @@ struct debugcpu_private
 	osd_ticks_t     last_periodic_update_time;
 
 	bool            comments_loaded;
+
+	/* recent device lookups made by expressions */
+	struct device_lookup
+	{
+		astring     tag;
+		device_t *  device;
+	};
+	device_lookup   device_cache[8];
+	int             device_cache_next;
 };
 
 
@@ -1137,10 +1146,28 @@ static void process_source_file(running_machine &machine)
 
 static device_t *expression_get_device(running_machine &machine, const char *tag)
 {
+	debugcpu_private *global = machine.debugcpu_data;
+
+	// every memory access in a cheat or breakpoint condition validates and reads by tag,
+	// so check the few devices looked up most recently before walking the device tree
+	for (int index = 0; index < ARRAY_LENGTH(global->device_cache); index++)
+		if (global->device_cache[index].device != NULL && global->device_cache[index].tag.icmp(tag) == 0)
+			return global->device_cache[index].device;
+
 	// convert to lowercase then lookup the name (tags are enforced to be all lower case)
 	astring fullname(tag);
 	fullname.makelower();
-	return machine.device(fullname);
+	device_t *device = machine.device(fullname);
+
+	// remember successful lookups, replacing the oldest
+	if (device != NULL)
+	{
+		debugcpu_private::device_lookup &entry = global->device_cache[global->device_cache_next];
+		global->device_cache_next = (global->device_cache_next + 1) % ARRAY_LENGTH(global->device_cache);
+		entry.tag.cpy(tag);
+		entry.device = device;
+	}
+	return device;
 }
 
 
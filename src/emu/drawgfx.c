@@ -22,6 +22,9 @@ UINT8 no_priority_size_is_wrong[2 * (sizeof(NO_PRIORITY) == 3) - 1];
 
 bitmap_ind8 drawgfx_dummy_priority_bitmap;
 
+// expands the 8 bits of a byte (MSB first) into 8 bytes of 0 or 1
+static UINT64 bitspread[256];
+
 
 
 /***************************************************************************
@@ -228,6 +231,8 @@ gfx_element::gfx_element(running_machine &machine)
 		m_dirtyseq(1),
 		m_gfxdata(NULL),
 		m_layout_is_raw(false),
+		m_layout_is_packed(false),
+		m_layout_is_byteplanar(false),
 		m_layout_planes(0),
 		m_layout_charincrement(0),
 		m_machine(machine)
@@ -252,6 +257,8 @@ gfx_element::gfx_element(running_machine &machine, UINT8 *base, UINT32 width, UI
 		m_dirtyseq(1),
 		m_gfxdata(base),
 		m_layout_is_raw(true),
+		m_layout_is_packed(false),
+		m_layout_is_byteplanar(false),
 		m_layout_planes(0),
 		m_layout_charincrement(0),
 		m_machine(machine)
@@ -276,6 +283,8 @@ gfx_element::gfx_element(running_machine &machine, const gfx_layout &gl, const U
 		m_dirtyseq(1),
 		m_gfxdata(NULL),
 		m_layout_is_raw(false),
+		m_layout_is_packed(false),
+		m_layout_is_byteplanar(false),
 		m_layout_planes(0),
 		m_layout_charincrement(0),
 		m_machine(machine)
@@ -315,6 +324,7 @@ void gfx_element::set_layout(const gfx_layout &gl, const UINT8 *srcdata)
 
 		// RAW graphics must have a pointer up front
 		assert(srcdata != NULL);
+		m_layout_is_packed = m_layout_is_byteplanar = false;
 		m_gfxdata_allocated.reset();
 		m_gfxdata = const_cast<UINT8 *>(m_srcdata);
 	}
@@ -334,6 +344,9 @@ void gfx_element::set_layout(const gfx_layout &gl, const UINT8 *srcdata)
 		m_line_modulo = m_origwidth;
 		m_char_modulo = m_line_modulo * m_origheight;
 
+		// see if one of the byte-at-a-time decoders applies
+		classify_layout();
+
 		// allocate memory for the data
 		m_gfxdata_allocated.resize(m_total_elements * m_char_modulo);
 		m_gfxdata = &m_gfxdata_allocated[0];
@@ -390,14 +403,121 @@ void gfx_element::set_source_clip(UINT32 xoffs, UINT32 width, UINT32 yoffs, UINT
 }
 
 
+//-------------------------------------------------
+//  classify_layout - detect layouts that can be
+//  decoded a byte at a time instead of a bit at
+//  a time
+//-------------------------------------------------
+
+void gfx_element::classify_layout()
+{
+	m_layout_is_packed = m_layout_is_byteplanar = false;
+	if (m_layout_charincrement % 8 != 0 || m_layout_planes > 8)
+		return;
+	for (int y = 0; y < m_origheight; y++)
+		if (m_layout_yoffset[y] % 8 != 0)
+			return;
+
+	// packed: each pixel is 4 or 8 consecutive bits with plane 0 as the MSB
+	bool packed = (m_layout_planes == 4 || m_layout_planes == 8) && (m_origwidth * m_layout_planes) % 8 == 0;
+	packed = packed && (m_layout_planeoffset[0] + m_layout_xoffset[0]) % 8 == 0;
+	for (int p = 1; packed && p < m_layout_planes; p++)
+		packed = (m_layout_planeoffset[p] == m_layout_planeoffset[0] + p);
+	for (int x = 1; packed && x < m_origwidth; x++)
+		packed = (m_layout_xoffset[x] == m_layout_xoffset[0] + x * m_layout_planes);
+	if (packed)
+	{
+		m_layout_is_packed = true;
+		return;
+	}
+
+	// byte planar: each plane holds runs of 8 pixels in a byte
+	bool byteplanar = (m_origwidth % 8 == 0);
+	for (int p = 0; byteplanar && p < m_layout_planes; p++)
+		byteplanar = (m_layout_planeoffset[p] % 8 == 0);
+	for (int x = 0; byteplanar && x < m_origwidth; x++)
+		byteplanar = (x % 8 == 0) ? (m_layout_xoffset[x] % 8 == 0) : (m_layout_xoffset[x] == m_layout_xoffset[x - 1] + 1);
+	if (!byteplanar)
+		return;
+
+	// build the bit expansion table the first time it is needed
+	if (bitspread[0xff] == 0)
+		for (int value = 0; value < 256; value++)
+		{
+			UINT8 expanded[8];
+			for (int bit = 0; bit < 8; bit++)
+				expanded[bit] = (value >> (7 - bit)) & 1;
+			memcpy(&bitspread[value], expanded, sizeof(expanded));
+		}
+	m_layout_is_byteplanar = true;
+}
+
+
+//-------------------------------------------------
+//  decode_packed - decode a character whose
+//  pixels are stored as packed nibbles or bytes
+//-------------------------------------------------
+
+void gfx_element::decode_packed(UINT32 code)
+{
+	UINT8 *dp = m_gfxdata + code * m_char_modulo;
+	const UINT8 *srcbase = m_srcdata + (code * m_layout_charincrement + m_layout_planeoffset[0] + m_layout_xoffset[0]) / 8;
+
+	for (int y = 0; y < m_origheight; y++, dp += m_line_modulo)
+	{
+		const UINT8 *sp = srcbase + m_layout_yoffset[y] / 8;
+		if (m_layout_planes == 8)
+			memcpy(dp, sp, m_origwidth);
+		else
+			for (int x = 0; x < m_origwidth; x += 2)
+			{
+				dp[x + 0] = sp[x / 2] >> 4;
+				dp[x + 1] = sp[x / 2] & 0x0f;
+			}
+	}
+}
+
+
+//-------------------------------------------------
+//  decode_byteplanar - decode a planar character
+//  8 pixels at a time, using a bit expansion
+//  table to convert each plane byte into 8
+//  pixel bytes within a 64-bit word
+//-------------------------------------------------
+
+void gfx_element::decode_byteplanar(UINT32 code)
+{
+	UINT8 *dp = m_gfxdata + code * m_char_modulo;
+	UINT32 charoffs = code * m_layout_charincrement;
+
+	for (int y = 0; y < m_origheight; y++, dp += m_line_modulo)
+		for (int x = 0; x < m_origwidth; x += 8)
+		{
+			UINT32 offs = charoffs + m_layout_yoffset[y] + m_layout_xoffset[x];
+			UINT64 pixels = 0;
+
+			// each byte of the expanded value holds 0 or 1, so shifting keeps the lanes apart
+			for (int plane = 0; plane < m_layout_planes; plane++)
+				pixels |= bitspread[m_srcdata[(offs + m_layout_planeoffset[plane]) / 8]] << (m_layout_planes - 1 - plane);
+			memcpy(dp + x, &pixels, sizeof(pixels));
+		}
+}
+
+
 //-------------------------------------------------
 //  decode - decode a single character
 //-------------------------------------------------
 
 void gfx_element::decode(UINT32 code)
 {
+	// byte-at-a-time decoders for the common layouts
+	if (m_layout_is_packed)
+		decode_packed(code);
+	else if (m_layout_is_byteplanar)
+		decode_byteplanar(code);
+
 	// don't decode GFX_RAW
-	if (!m_layout_is_raw)
+	else if (!m_layout_is_raw)
 	{
 		// zap the data to 0
 		UINT8 *decode_base = m_gfxdata + code * m_char_modulo;
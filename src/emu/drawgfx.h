@@ -168,6 +168,11 @@ public:
 	}
 
 private:
+	// internal helpers
+	void classify_layout();
+	void decode_packed(UINT32 code);
+	void decode_byteplanar(UINT32 code);
+
 	// internal state
 	UINT16          m_width;                // current pixel width of each element (changeble with source clipping)
 	UINT16          m_height;               // current pixel height of each element (changeble with source clipping)
@@ -194,6 +199,8 @@ private:
 	dynamic_array<UINT32> m_pen_usage;      // bitmask of pens that are used (pens 0-31 only)
 
 	bool            m_layout_is_raw;        // raw layout?
+	bool            m_layout_is_packed;     // pixels stored as 4 or 8 consecutive bits, byte aligned rows?
+	bool            m_layout_is_byteplanar; // each plane stores 8 consecutive pixels per byte, byte aligned?
 	UINT8           m_layout_planes;        // bit planes in the layout
 	UINT32          m_layout_charincrement; // per-character increment in source data
 	dynamic_array<UINT32> m_layout_planeoffset;// plane offsets
@@ -209,14 +209,20 @@ int driver_list::driver_sort_callback(const void *elem1, const void *elem2)
 
 //-------------------------------------------------
 //  penalty_compare - compare two strings for
-//  closeness and assign a score.
+//  closeness and assign a score. Scoring stops
+//  early once the result is known to be at
+//  least limit.
 //-------------------------------------------------
 
-int driver_list::penalty_compare(const char *source, const char *target)
+int driver_list::penalty_compare(const char *source, const char *target, int limit)
 {
 	int gaps = 1;
 	bool last = true;
 
+	// gaps only ever grow, and only a perfect match brings 1 back down to 0
+	if (limit < 2)
+		limit = 2;
+
 	// scan the strings
 	for ( ; *source && *target; target++)
 	{
@@ -231,8 +237,8 @@ int driver_list::penalty_compare(const char *source, const char *target)
 		if (match != last)
 		{
 			last = match;
-			if (!match)
-				gaps++;
+			if (!match && ++gaps >= limit)
+				return gaps;
 		}
 	}
 
@@ -490,9 +496,11 @@ void driver_enumerator::find_approximate_matches(const char *string, int count,
 			if ((s_drivers_sorted[index]->flags & GAME_NO_STANDALONE) != 0)
 				continue;
 
-			// pick the best match between driver name and description
-			int curpenalty = penalty_compare(string, s_drivers_sorted[index]->description);
-			int tmp = penalty_compare(string, s_drivers_sorted[index]->name);
+			// pick the best match between driver name and description; anything
+			// scoring at least as badly as the last entry in the table can't get in,
+			// so there's no need to finish scoring it
+			int curpenalty = penalty_compare(string, s_drivers_sorted[index]->description, penalty[count - 1]);
+			int tmp = penalty_compare(string, s_drivers_sorted[index]->name, MIN(curpenalty, penalty[count - 1]));
 			curpenalty = MIN(curpenalty, tmp);
 
 			// insert into the sorted table of matches
@@ -87,7 +87,7 @@ public:
 protected:
 	// internal helpers
 	static int driver_sort_callback(const void *elem1, const void *elem2);
-	static int penalty_compare(const char *source, const char *target);
+	static int penalty_compare(const char *source, const char *target, int limit = 9999);
 
 	// internal state
 	static int                          s_driver_count;
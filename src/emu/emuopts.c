@@ -94,6 +94,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SNAPSHOT_DIRECTORY,                         "snap",      OPTION_STRING,     "directory to save screenshots" },
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      OPTION_STRING,     "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  OPTION_STRING,     "directory to save debugger comments" },
+	{ OPTION_CACHE_DIRECTORY,                            "cache",     OPTION_STRING,     "directory to save cached ROM data, audit results and validity check results" },
 #ifdef USE_HISCORE
 	{ "hiscore_directory",                               "hi",        OPTION_STRING,     "directory to save hiscores" },
 #endif /* USE_HISCORE */
@@ -113,6 +114,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_AUTOSAVE,                                   "0",         OPTION_BOOLEAN,    "enable automatic restore at startup, and automatic save at exit time" },
 	{ OPTION_PLAYBACK ";pb",                             NULL,        OPTION_STRING,     "playback an input file" },
 	{ OPTION_RECORD ";rec",                              NULL,        OPTION_STRING,     "record an input file" },
+	{ OPTION_EXIT_AFTER_PLAYBACK,                        "0",         OPTION_BOOLEAN,    "exit when the input playback file ends" },
+	{ OPTION_PLAYBACK_CHECKPOINT,                        "0",         OPTION_INTEGER,    "save a state every N emulated seconds during playback (0 == never); playback resumes from one with -state" },
 	{ OPTION_MNGWRITE,                                   NULL,        OPTION_STRING,     "optional filename to write a MNG movie of the current session" },
 	{ OPTION_AVIWRITE,                                   NULL,        OPTION_STRING,     "optional filename to write an AVI movie of the current session" },
 	{ OPTION_WAVWRITE,                                   NULL,        OPTION_STRING,     "optional filename to write a WAV file of the current session" },
@@ -130,6 +133,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SLEEP,                                      "1",         OPTION_BOOLEAN,    "enable sleeping, which gives time back to other applications when idle" },
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjusts the speed of gameplay to keep the refresh rate lower than the screen" },
+	{ OPTION_ROM_CACHE,                                  "0",         OPTION_BOOLEAN,    "keep decrypted ROM data in the cache directory and reuse it on later launches" },
+	{ OPTION_SHARE_REGIONS,                              "0",         OPTION_BOOLEAN,    "back large ROM regions with files in the cache directory so that running instances share their memory" },
+	{ OPTION_AUDIT_CACHE,                                "0",         OPTION_BOOLEAN,    "remember -verifyroms results in the cache directory and skip sets whose files have not changed" },
 
 	// rotation options
 	{ NULL,                                              NULL,        OPTION_HEADER,     "CORE ROTATION OPTIONS" },
@@ -177,6 +183,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SAMPLERATE ";sr(1000-1000000)",             "44100",     OPTION_INTEGER,    "set sound output sample rate" },
 	{ OPTION_SAMPLES,                                    "1",         OPTION_BOOLEAN,    "enable the use of external samples if available" },
 	{ OPTION_VOLUME ";vol",                              "0",         OPTION_INTEGER,    "sound volume in decibels (-32 min, 0 max)" },
+	{ OPTION_DEFER_SOUND_WRITES,                         "0",         OPTION_BOOLEAN,    "queue sound chip register writes and apply them when the chip's stream renders" },
+	{ OPTION_ADPCM_CACHE,                                "1",         OPTION_BOOLEAN,    "decode each ADPCM sample phrase once and replay it from a cache" },
 
 	// input options
 	{ NULL,                                              NULL,        OPTION_HEADER,     "CORE INPUT OPTIONS" },
@@ -103,6 +103,7 @@ enum
 #define OPTION_SNAPSHOT_DIRECTORY   "snapshot_directory"
 #define OPTION_DIFF_DIRECTORY       "diff_directory"
 #define OPTION_COMMENT_DIRECTORY    "comment_directory"
+#define OPTION_CACHE_DIRECTORY      "cache_directory"
 #ifdef USE_HISCORE
 #define OPTION_HISCORE_DIRECTORY    "hiscore_directory"
 #endif /* USE_HISCORE */
@@ -120,6 +121,8 @@ enum
 #define OPTION_AUTOSAVE             "autosave"
 #define OPTION_PLAYBACK             "playback"
 #define OPTION_RECORD               "record"
+#define OPTION_EXIT_AFTER_PLAYBACK  "exit_after_playback"
+#define OPTION_PLAYBACK_CHECKPOINT  "playback_checkpoint"
 #define OPTION_MNGWRITE             "mngwrite"
 #define OPTION_AVIWRITE             "aviwrite"
 #define OPTION_WAVWRITE             "wavwrite"
@@ -136,6 +139,9 @@ enum
 #define OPTION_SLEEP                "sleep"
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
+#define OPTION_ROM_CACHE            "rom_cache"
+#define OPTION_SHARE_REGIONS        "share_regions"
+#define OPTION_AUDIT_CACHE          "audit_cache"
 
 // core rotation options
 #define OPTION_ROTATE               "rotate"
@@ -178,6 +184,8 @@ enum
 #define OPTION_SAMPLERATE           "samplerate"
 #define OPTION_SAMPLES              "samples"
 #define OPTION_VOLUME               "volume"
+#define OPTION_DEFER_SOUND_WRITES   "defer_sound_writes"
+#define OPTION_ADPCM_CACHE          "adpcm_cache"
 
 // core input options
 #define OPTION_COIN_LOCKOUT         "coin_lockout"
@@ -310,12 +318,15 @@ public:
 	const char *snapshot_directory() const { return value(OPTION_SNAPSHOT_DIRECTORY); }
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
+	const char *cache_directory() const { return value(OPTION_CACHE_DIRECTORY); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
 	const char *record() const { return value(OPTION_RECORD); }
+	bool exit_after_playback() const { return bool_value(OPTION_EXIT_AFTER_PLAYBACK); }
+	int playback_checkpoint() const { return int_value(OPTION_PLAYBACK_CHECKPOINT); }
 	const char *mng_write() const { return value(OPTION_MNGWRITE); }
 	const char *avi_write() const { return value(OPTION_AVIWRITE); }
 	const char *wav_write() const { return value(OPTION_WAVWRITE); }
@@ -332,6 +343,9 @@ public:
 	bool sleep() const { return bool_value(OPTION_SLEEP); }
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return bool_value(OPTION_REFRESHSPEED); }
+	bool rom_cache() const { return bool_value(OPTION_ROM_CACHE); }
+	bool share_regions() const { return bool_value(OPTION_SHARE_REGIONS); }
+	bool audit_cache() const { return bool_value(OPTION_AUDIT_CACHE); }
 
 	// core rotation options
 	bool rotate() const { return bool_value(OPTION_ROTATE); }
@@ -370,6 +384,8 @@ public:
 	int sample_rate() const { return int_value(OPTION_SAMPLERATE); }
 	bool samples() const { return bool_value(OPTION_SAMPLES); }
 	int volume() const { return int_value(OPTION_VOLUME); }
+	bool defer_sound_writes() const { return bool_value(OPTION_DEFER_SOUND_WRITES); }
+	bool adpcm_cache() const { return bool_value(OPTION_ADPCM_CACHE); }
 
 	// core input options
 	bool coin_lockout() const { return bool_value(OPTION_COIN_LOCKOUT); }
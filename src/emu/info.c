@@ -242,9 +242,17 @@ void info_xml_creator::output(FILE *out)
 		CONFIG_VERSION
 	);
 
-	// iterate through the drivers, outputting one at a time
+	// iterate through the drivers, outputting one at a time; note which ones
+	// introduce new devices while their configurations are at hand, so that
+	// output_devices doesn't have to build every configuration a second time
+	slot_map shortnames;
+	m_device_drivers.reset();
 	while (m_drivlist.next())
+	{
 		output_one();
+		if (output_new_devices(m_drivlist.config(), shortnames, false))
+			m_device_drivers.append(m_drivlist.current());
+	}
 
 	// output devices (both devices with roms and slot devices)
 	output_devices();
@@ -392,56 +400,81 @@ void info_xml_creator::output_one_device(device_t &device, const char *devtag)
 
 
 //-------------------------------------------------
-//  output_devices - print the XML info for devices
-//  with roms and for devices that can be mounted
-//  in slots
+//  output_new_devices - find the devices with
+//  roms and the devices that can be mounted in
+//  slots of a configuration that aren't in the
+//  map of shortnames yet, add them, and print
+//  their XML info if requested; returns true if
+//  there were any
 //-------------------------------------------------
 
-typedef tagmap_t<FPTR> slot_map;
-
-void info_xml_creator::output_devices()
+bool info_xml_creator::output_new_devices(machine_config &config, slot_map &shortnames, bool output)
 {
-	m_drivlist.reset();
-	slot_map shortnames;
+	bool found = false;
 
-	while (m_drivlist.next())
+	// first, run through devices with roms which belongs to the default configuration
+	device_iterator deviter(config.root_device());
+	for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
 	{
-		// first, run through devices with roms which belongs to the default configuration
-		device_iterator deviter(m_drivlist.config().root_device());
-		for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
+		if (device->owner() != NULL && device->rom_region() != NULL && device->shortname()!= NULL)
 		{
-			if (device->owner() != NULL && device->rom_region() != NULL && device->shortname()!= NULL)
+			if (shortnames.add(device->shortname(), 0, FALSE) != TMERR_DUPLICATE)
 			{
-				if (shortnames.add(device->shortname(), 0, FALSE) != TMERR_DUPLICATE)
+				found = true;
+				if (output)
 					output_one_device(*device, device->tag());
 			}
 		}
+	}
 
-		// then, run through slot devices
-		slot_interface_iterator iter(m_drivlist.config().root_device());
-		for (const device_slot_interface *slot = iter.first(); slot != NULL; slot = iter.next())
+	// then, run through slot devices
+	slot_interface_iterator iter(config.root_device());
+	for (const device_slot_interface *slot = iter.first(); slot != NULL; slot = iter.next())
+	{
+		const slot_interface* intf = slot->get_slot_interfaces();
+		for (int i = 0; intf && intf[i].name != NULL; i++)
 		{
-			const slot_interface* intf = slot->get_slot_interfaces();
-			for (int i = 0; intf && intf[i].name != NULL; i++)
-			{
-				astring temptag("_");
-				temptag.cat(intf[i].name);
-				device_t *dev = const_cast<machine_config &>(m_drivlist.config()).device_add(&m_drivlist.config().root_device(), temptag.cstr(), intf[i].devtype, 0);
+			astring temptag("_");
+			temptag.cat(intf[i].name);
+			device_t *dev = config.device_add(&config.root_device(), temptag.cstr(), intf[i].devtype, 0);
 
-				// notify this device and all its subdevices that they are now configured
-				device_iterator subiter(*dev);
-				for (device_t *device = subiter.first(); device != NULL; device = subiter.next())
-					if (!device->configured())
-						device->config_complete();
+			// notify this device and all its subdevices that they are now configured
+			device_iterator subiter(*dev);
+			for (device_t *device = subiter.first(); device != NULL; device = subiter.next())
+				if (!device->configured())
+					device->config_complete();
 
-				if (shortnames.add(dev->shortname(), 0, FALSE) != TMERR_DUPLICATE)
+			if (shortnames.add(dev->shortname(), 0, FALSE) != TMERR_DUPLICATE)
+			{
+				found = true;
+				if (output)
 					output_one_device(*dev, temptag.cstr());
-
-				const_cast<machine_config &>(m_drivlist.config()).device_remove(&m_drivlist.config().root_device(), temptag.cstr());
-				global_free(dev);
 			}
+
+			config.device_remove(&config.root_device(), temptag.cstr());
+			global_free(dev);
 		}
 	}
+	return found;
+}
+
+
+//-------------------------------------------------
+//  output_devices - print the XML info for devices
+//  with roms and for devices that can be mounted
+//  in slots
+//-------------------------------------------------
+
+void info_xml_creator::output_devices()
+{
+	// only the drivers output() found to introduce devices can print any,
+	// and they find the same ones again in the same order
+	slot_map shortnames;
+	for (int index = 0; index < m_device_drivers.count(); index++)
+	{
+		m_drivlist.set_current(m_device_drivers[index]);
+		output_new_devices(m_drivlist.config(), shortnames, true);
+	}
 }
 
 
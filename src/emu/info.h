@@ -52,6 +52,8 @@
 // helper class to putput
 class info_xml_creator
 {
+	typedef tagmap_t<FPTR> slot_map;
+
 public:
 	// construction/destruction
 	info_xml_creator(driver_enumerator &drivlist);
@@ -80,6 +82,7 @@ private:
 	void output_ramoptions();
 
 	void output_one_device(device_t &device, const char *devtag);
+	bool output_new_devices(machine_config &config, slot_map &shortnames, bool output);
 	void output_devices();
 
 	const char *get_merge_name(const hash_collection &romhashes);
@@ -88,6 +91,7 @@ private:
 	FILE *                  m_output;
 	driver_enumerator &     m_drivlist;
 	emu_options             m_lookup_options;
+	dynamic_array<int>      m_device_drivers;
 
 	static const char s_dtd_string[];
 };
@@ -2805,7 +2805,9 @@ ioport_manager::ioport_manager(running_machine &machine)
 		m_caption_timer(0),
 #endif /* INP_CAPTION */
 		m_playback_accumulated_speed(0),
-		m_playback_accumulated_frames(0)
+		m_playback_accumulated_frames(0),
+		m_playback_next_checkpoint(0),
+		m_playback_catchup(false)
 {
 	memset(m_type_to_entry, 0, sizeof(m_type_to_entry));
 #ifdef USE_SHOW_INPUT_LOG
@@ -3858,6 +3860,12 @@ time_t ioport_manager::playback_init()
 
 	// enable compression
 	m_playback_file.compress(FCOMPRESS_MEDIUM);
+
+	// note when the first checkpoint is due
+	m_playback_next_checkpoint = MAX(machine().options().playback_checkpoint(), 0);
+
+	// a run started from a saved state begins partway through the recording
+	m_playback_catchup = (machine().options().state()[0] != 0);
 	return basetime;
 }
 
@@ -3891,6 +3899,10 @@ void ioport_manager::playback_end(const char *message)
 			machine().pause();
 #endif /* PLAYBACK_END_PAUSE */
 
+		// batch rendering of a playback stops here
+		if (machine().options().exit_after_playback())
+			machine().schedule_exit();
+
 		// display speed stats
 		m_playback_accumulated_speed /= m_playback_accumulated_frames;
 		mame_printf_info("Total playback frames: %d\n", UINT32(m_playback_accumulated_frames));
@@ -3913,6 +3925,16 @@ void ioport_manager::playback_frame(attotime curtime)
 		attotime readtime;
 		playback_read(readtime.seconds);
 		playback_read(readtime.attoseconds);
+
+		// if we started from a saved state, skip ahead to the current frame once;
+		// after that, any mismatch is a real desync
+		while (m_playback_catchup && readtime < curtime && m_playback_file.is_open())
+		{
+			playback_skip_frame();
+			playback_read(readtime.seconds);
+			playback_read(readtime.attoseconds);
+		}
+		m_playback_catchup = false;
 		if (readtime != curtime)
 			playback_end("Out of sync");
 
@@ -3920,10 +3942,34 @@ void ioport_manager::playback_frame(attotime curtime)
 		UINT32 curspeed;
 		m_playback_accumulated_speed += playback_read(curspeed);
 		m_playback_accumulated_frames++;
+
+		// save a checkpoint that a later run can start rendering from
+		if (m_playback_next_checkpoint != 0 && m_playback_file.is_open() && curtime.seconds >= m_playback_next_checkpoint)
+		{
+			astring name;
+			machine().schedule_save(name.format("playback-%05d", curtime.seconds));
+			m_playback_next_checkpoint = curtime.seconds + machine().options().playback_checkpoint();
+		}
 	}
 }
 
 
+//-------------------------------------------------
+//  playback_skip_frame - read past the rest of a
+//  frame's playback data
+//-------------------------------------------------
+
+void ioport_manager::playback_skip_frame()
+{
+	UINT32 curspeed;
+	playback_read(curspeed);
+
+	// the port values are overwritten when the current frame is read
+	for (ioport_port *port = first_port(); port != NULL; port = port->next())
+		playback_port(*port);
+}
+
+
 //-------------------------------------------------
 //  playback_port - per-port callback for playback
 //-------------------------------------------------
@@ -1359,6 +1359,7 @@ private:
 	void playback_end(const char *message = NULL);
 	void playback_frame(attotime curtime);
 	void playback_port(ioport_port &port);
+	void playback_skip_frame();
 
 	template<typename _Type> void record_write(_Type value);
 	void record_init();
@@ -1410,6 +1411,8 @@ private:
 #endif /* INP_CAPTION */
 	UINT64                  m_playback_accumulated_speed; // accumulated speed during playback
 	UINT32                  m_playback_accumulated_frames; // accumulated frames during playback
+	UINT32                  m_playback_next_checkpoint; // emulated second of the next playback checkpoint (0 if none)
+	bool                    m_playback_catchup;     // true until playback started from a saved state reaches the current frame
 };
 
 
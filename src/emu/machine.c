@@ -109,6 +109,7 @@
 #include "crsshair.h"
 #include "validity.h"
 #include "unzip.h"
+#include "un7z.h"
 #include "debug/debugcon.h"
 #ifdef USE_HISCORE
 #include "hiscore.h"
@@ -127,6 +128,36 @@ static char giant_string_buffer[65536] = { 0 };
 
 
 
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  ticks_to_ms - convert an osd_ticks interval
+//  to milliseconds for the startup trace
+//-------------------------------------------------
+
+inline double ticks_to_ms(osd_ticks_t ticks)
+{
+	return (double)ticks * 1000.0 / (double)osd_ticks_per_second();
+}
+
+
+//-------------------------------------------------
+//  log_startup_phase - report how long a phase of
+//  machine startup took, and start timing the
+//  next one
+//-------------------------------------------------
+
+inline void log_startup_phase(const char *name, osd_ticks_t &start)
+{
+	osd_ticks_t now = osd_ticks();
+	mame_printf_verbose("Startup: %s took %.3fms\n", name, ticks_to_ms(now - start));
+	start = now;
+}
+
+
+
 //**************************************************************************
 //  RUNNING MACHINE
 //**************************************************************************
@@ -286,8 +317,11 @@ void running_machine::start()
 
 	// first load ROMs, then populate memory, and finally initialize CPUs
 	// these operations must proceed in this order
+	osd_ticks_t phase = osd_ticks();
 	rom_init(*this);
+	log_startup_phase("ROM loading", phase);
 	m_memory.initialize();
+	log_startup_phase("memory setup", phase);
 
 	// initialize the watchdog
 	m_watchdog_timer = m_scheduler.timer_alloc(timer_expired_delegate(FUNC(running_machine::watchdog_fired), this));
@@ -298,6 +332,7 @@ void running_machine::start()
 
 	// allocate the gfx elements prior to device initialization
 	gfx_init(*this);
+	log_startup_phase("graphics decoding", phase);
 
 	// initialize image devices
 	image_init(*this);
@@ -319,7 +354,9 @@ void running_machine::start()
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(running_machine::stop_all_devices), this));
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
+	phase = osd_ticks();
 	start_all_devices();
+	log_startup_phase("device startup", phase);
 
 	// if we're coming in with a savegame request, process it now
 	const char *savegame = options().state();
@@ -464,6 +501,7 @@ int running_machine::run(bool firstrun)
 	// call all exit callbacks registered
 	call_notifiers(MACHINE_NOTIFY_EXIT);
 	zip_file_cache_clear();
+	_7z_file_cache_clear();
 
 	// close the logfile
 	auto_free(*this, m_logfile);
@@ -975,7 +1013,9 @@ void running_machine::start_all_devices()
 
 					// now start the device
 					mame_printf_verbose("Starting %s '%s'\n", device->name(), device->tag());
+					osd_ticks_t start = osd_ticks();
 					device->start();
+					mame_printf_verbose("  (started in %.3fms)\n", ticks_to_ms(osd_ticks() - start));
 				}
 
 				// handle missing dependencies by moving the device to the end
@@ -168,11 +168,12 @@ int mame_execute(emu_options &options, osd_interface &osd)
 			astring errors;
 			options.parse_standard_inis(errors);
 		}
-		// otherwise, perform validity checks before anything else
+		// otherwise, perform validity checks before anything else; each build
+		// only needs to see a given source file pass once
 		if (system != NULL)
 		{
 			validity_checker valid(options);
-			valid.check_shared_source(*system);
+			valid.check_shared_source_once(*system);
 		}
 
 		// create the machine configuration
@@ -4271,6 +4271,10 @@ memory_region::memory_region(running_machine &machine, const char *name, UINT32
 		m_next(NULL),
 		m_name(name),
 		m_buffer(length),
+		m_base(&m_buffer[0]),
+		m_length(length),
+		m_mapping(NULL),
+		m_maplength(0),
 		m_width(width),
 		m_endianness(endian)
 {
@@ -4278,6 +4282,36 @@ memory_region::memory_region(running_machine &machine, const char *name, UINT32
 }
 
 
+//-------------------------------------------------
+//  ~memory_region - destructor
+//-------------------------------------------------
+
+memory_region::~memory_region()
+{
+	if (m_mapping != NULL)
+		osd_unmap_file(m_mapping, m_maplength);
+}
+
+
+//-------------------------------------------------
+//  attach_mapping - replace the region's private
+//  buffer with a copy-on-write file mapping that
+//  the caller has verified holds the same data;
+//  this must happen before anyone has taken a
+//  pointer into the region
+//-------------------------------------------------
+
+void memory_region::attach_mapping(void *mapping, UINT64 maplength)
+{
+	assert(m_mapping == NULL && maplength == m_length);
+
+	m_mapping = mapping;
+	m_maplength = maplength;
+	m_base = reinterpret_cast<UINT8 *>(mapping);
+	m_buffer.reset();
+}
+
+
 
 //**************************************************************************
 //  HANDLER ENTRY
@@ -765,22 +765,24 @@ class memory_region
 
 	// construction/destruction
 	memory_region(running_machine &machine, const char *name, UINT32 length, UINT8 width, endianness_t endian);
+	~memory_region();
 
 public:
 	// getters
 	running_machine &machine() const { return m_machine; }
 	memory_region *next() const { return m_next; }
-	UINT8 *base() { return (this != NULL) ? &m_buffer[0] : NULL; }
-	UINT8 *end() { return (this != NULL) ? base() + m_buffer.count() : NULL; }
-	UINT32 bytes() const { return (this != NULL) ? m_buffer.count() : 0; }
+	UINT8 *base() { return (this != NULL) ? m_base : NULL; }
+	UINT8 *end() { return (this != NULL) ? m_base + m_length : NULL; }
+	UINT32 bytes() const { return (this != NULL) ? m_length : 0; }
 	const char *name() const { return m_name; }
+	bool mapped() const { return (m_mapping != NULL); }
 
 	// flag expansion
 	endianness_t endianness() const { return m_endianness; }
 	UINT8 width() const { return m_width; }
 
 	// data access
-	UINT8 &u8(offs_t offset = 0) { return m_buffer[offset]; }
+	UINT8 &u8(offs_t offset = 0) { return m_base[offset]; }
 	UINT16 &u16(offs_t offset = 0) { return reinterpret_cast<UINT16 *>(base())[offset]; }
 	UINT32 &u32(offs_t offset = 0) { return reinterpret_cast<UINT32 *>(base())[offset]; }
 	UINT64 &u64(offs_t offset = 0) { return reinterpret_cast<UINT64 *>(base())[offset]; }
@@ -796,12 +798,19 @@ public:
 	operator INT64 *() { return (this != NULL) ? reinterpret_cast<INT64 *>(base()) : NULL; }
 	operator UINT64 *() { return (this != NULL) ? reinterpret_cast<UINT64 *>(base()) : NULL; }
 
+	// switch to a copy-on-write file mapping holding identical contents
+	void attach_mapping(void *mapping, UINT64 maplength);
+
 private:
 	// internal data
 	running_machine &       m_machine;
 	memory_region *         m_next;
 	astring                 m_name;
 	dynamic_buffer          m_buffer;
+	UINT8 *                 m_base;
+	UINT32                  m_length;
+	void *                  m_mapping;
+	UINT64                  m_maplength;
 	UINT8                   m_width;
 	endianness_t            m_endianness;
 };
@@ -409,12 +409,7 @@ void render_texture::release()
 {
 	// free all scaled versions
 	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-	{
-		m_manager->invalidate_all(m_scaled[scalenum].bitmap);
-		auto_free(m_manager->machine(), m_scaled[scalenum].bitmap);
-		m_scaled[scalenum].bitmap = NULL;
-		m_scaled[scalenum].seqid = 0;
-	}
+		free_scaled(m_scaled[scalenum]);
 
 	// invalidate references to the original bitmap as well
 	m_manager->invalidate_all(m_bitmap);
@@ -453,15 +448,26 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 
 	// invalidate all scaled versions
 	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+		free_scaled(m_scaled[scalenum]);
+}
+
+
+//-------------------------------------------------
+//  free_scaled - release a scaled variant and
+//  remove it from the manager's accounting
+//-------------------------------------------------
+
+void render_texture::free_scaled(scaled_texture &scaled)
+{
+	if (scaled.bitmap != NULL)
 	{
-		if (m_scaled[scalenum].bitmap != NULL)
-		{
-			m_manager->invalidate_all(m_scaled[scalenum].bitmap);
-			auto_free(m_manager->machine(), m_scaled[scalenum].bitmap);
-		}
-		m_scaled[scalenum].bitmap = NULL;
-		m_scaled[scalenum].seqid = 0;
+		m_manager->m_scaled_bytes -= (UINT64)scaled.bitmap->rowbytes() * scaled.bitmap->height();
+		m_manager->invalidate_all(scaled.bitmap);
+		auto_free(m_manager->machine(), scaled.bitmap);
 	}
+	scaled.bitmap = NULL;
+	scaled.seqid = 0;
+	scaled.lastuse = 0;
 }
 
 
@@ -529,28 +535,30 @@ bool render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 	{
 		int lowest = -1;
 
-		// didn't find one -- take the entry with the lowest seqnum
+		// didn't find one -- take the least recently used entry
 		for (scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-			if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap))
+			if ((lowest == -1 || m_scaled[scalenum].lastuse < m_scaled[lowest].lastuse) && !primlist.has_reference(m_scaled[scalenum].bitmap))
 				lowest = scalenum;
 		assert_always(lowest != -1, "Too many live texture instances!");
 
 		// throw out any existing entries
 		scaled = &m_scaled[lowest];
-		if (scaled->bitmap != NULL)
-		{
-			m_manager->invalidate_all(scaled->bitmap);
-			auto_free(m_manager->machine(), scaled->bitmap);
-		}
+		free_scaled(*scaled);
 
 		// allocate a new bitmap
 		scaled->bitmap = auto_alloc(m_manager->machine(), bitmap_argb32(dwidth, dheight));
 		scaled->seqid = ++m_curseq;
+		m_manager->m_scaled_bytes += (UINT64)scaled->bitmap->rowbytes() * scaled->bitmap->height();
 
 		// let the scaler do the work
 		(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
 	}
 
+	// note the use for LRU purposes; the seqid only changes with the content
+	scaled->lastuse = m_manager->m_scaled_frame;
+	if (m_manager->m_scaled_bytes > render_manager::SCALED_CACHE_BYTES)
+		m_manager->trim_scaled(scaled->bitmap, primlist);
+
 	// finally fill out the new info
 	primlist.add_reference(scaled->bitmap);
 	texinfo.base = &scaled->bitmap->pix32(0);
@@ -1484,6 +1492,9 @@ render_primitive_list &render_target::get_primitives()
 	m_listindex = (m_listindex + 1) % ARRAY_LENGTH(m_primlist);
 	list.acquire_lock();
 
+	// advance the clock used to age cached scaled textures
+	m_manager.m_scaled_frame++;
+
 	// free any previous primitives
 	list.release_all();
 
@@ -2595,6 +2606,8 @@ render_manager::render_manager(running_machine &machine)
 		m_ui_target(NULL),
 		m_live_textures(0),
 		m_texture_allocator(machine.respool()),
+		m_scaled_bytes(0),
+		m_scaled_frame(0),
 		m_ui_container(auto_alloc(machine, render_container(*this))),
 		m_screen_container_list(machine.respool())
 {
@@ -2734,6 +2747,10 @@ render_texture *render_manager::texture_alloc(texture_scaler_func scaler, void *
 	render_texture *tex = m_texture_allocator.alloc();
 	tex->reset(*this, scaler, param);
 	m_live_textures++;
+
+	// only textures with a scaler ever hold scaled variants
+	if (scaler != NULL)
+		m_scaler_textures.append(tex);
 	return tex;
 }
 
@@ -2748,11 +2765,58 @@ void render_manager::texture_free(render_texture *texture)
 	{
 		m_live_textures--;
 		texture->release();
+
+		// stop tracking it for the scaled texture cache
+		for (int texnum = 0; texnum < m_scaler_textures.count(); texnum++)
+			if (m_scaler_textures[texnum] == texture)
+			{
+				m_scaler_textures[texnum] = m_scaler_textures[m_scaler_textures.count() - 1];
+				m_scaler_textures.resize(m_scaler_textures.count() - 1, true);
+				break;
+			}
 	}
 	m_texture_allocator.reclaim(texture);
 }
 
 
+//-------------------------------------------------
+//  trim_scaled - when the cache is over budget,
+//  drop the least recently used scaled variants
+//  of any texture, skipping those in use
+//-------------------------------------------------
+
+void render_manager::trim_scaled(const bitmap_argb32 *keep, render_primitive_list &primlist)
+{
+	while (m_scaled_bytes > SCALED_CACHE_BYTES)
+	{
+		// find the oldest variant that has sat unused for a few frames
+		render_texture *oldtex = NULL;
+		int oldnum = 0;
+		for (int texnum = 0; texnum < m_scaler_textures.count(); texnum++)
+		{
+			render_texture *texture = m_scaler_textures[texnum];
+			for (int scalenum = 0; scalenum < ARRAY_LENGTH(texture->m_scaled); scalenum++)
+			{
+				render_texture::scaled_texture &scaled = texture->m_scaled[scalenum];
+				if (scaled.bitmap == NULL || scaled.bitmap == keep || m_scaled_frame - scaled.lastuse <= SCALED_CACHE_MIN_AGE)
+					continue;
+				if (oldtex != NULL && m_scaled_frame - scaled.lastuse <= m_scaled_frame - oldtex->m_scaled[oldnum].lastuse)
+					continue;
+				if (primlist.has_reference(scaled.bitmap))
+					continue;
+				oldtex = texture;
+				oldnum = scalenum;
+			}
+		}
+
+		// everything left is recent or in use
+		if (oldtex == NULL)
+			break;
+		oldtex->free_scaled(oldtex->m_scaled[oldnum]);
+	}
+}
+
+
 //-------------------------------------------------
 //  font_alloc - allocate a new font instance
 //-------------------------------------------------
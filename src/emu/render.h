@@ -475,8 +475,11 @@ private:
 	{
 		bitmap_argb32 *     bitmap;                 // final bitmap
 		UINT32              seqid;                  // sequence number
+		UINT32              lastuse;                // manager frame stamp of the last lookup
 	};
 
+	void free_scaled(scaled_texture &scaled);
+
 	// internal state
 	render_manager *    m_manager;                  // reference to our manager
 	render_texture *    m_next;                     // next texture (for free list)
@@ -755,6 +758,7 @@ private:
 class render_manager
 {
 	friend class render_target;
+	friend class render_texture;
 
 public:
 	// construction/destruction
@@ -798,6 +802,9 @@ private:
 	render_container *container_alloc(screen_device *screen = NULL);
 	void container_free(render_container *container);
 
+	// scaled texture cache
+	void trim_scaled(const bitmap_argb32 *keep, render_primitive_list &primlist);
+
 	// config callbacks
 	void config_load(int config_type, xml_data_node *parentnode);
 	void config_save(int config_type, xml_data_node *parentnode);
@@ -809,9 +816,16 @@ private:
 	simple_list<render_target>      m_targetlist;       // list of targets
 	render_target *                 m_ui_target;        // current UI target
 
+	// scaled texture cache limits
+	static const UINT64 SCALED_CACHE_BYTES = 64 * 1024 * 1024;
+	static const UINT32 SCALED_CACHE_MIN_AGE = 8;
+
 	// texture lists
 	UINT32                          m_live_textures;    // number of live textures
 	fixed_allocator<render_texture> m_texture_allocator;// texture allocator
+	UINT64                          m_scaled_bytes;     // bytes held by all scaled texture bitmaps
+	UINT32                          m_scaled_frame;     // stamp bumped for each primitive list built
+	dynamic_array<render_texture *> m_scaler_textures;  // live textures that can hold scaled variants
 
 	// containers for the UI and for screens
 	render_container *              m_ui_container;     // UI container
@@ -16,6 +16,7 @@
 #include "harddisk.h"
 #include "config.h"
 #include "ui.h"
+#include "un7z.h"
 #ifdef USE_IPS
 #include "ips.h"
 #endif /* USE_IPS */
@@ -31,6 +32,9 @@
 
 #define TEMPBUFFER_MAX_SIZE     (1024 * 1024 * 1024)
 
+/* smallest region worth backing with a shared file mapping */
+#define SHARED_REGION_MIN_SIZE  (1024 * 1024)
+
 
 
 /***************************************************************************
@@ -429,14 +433,14 @@ static void dump_wrong_and_correct_checksums(romload_private *romdata, const has
     and hash signatures of a file
 -------------------------------------------------*/
 
-static void verify_length_and_hash(romload_private *romdata, const char *name, UINT32 explength, const hash_collection &hashes)
+static void verify_length_and_hash(romload_private *romdata, emu_file *file, const char *name, UINT32 explength, const hash_collection &hashes)
 {
 	/* we've already complained if there is no file */
-	if (romdata->file == NULL)
+	if (file == NULL)
 		return;
 
 	/* verify length */
-	UINT32 actlength = romdata->file->size();
+	UINT32 actlength = file->size();
 	if (explength != actlength)
 	{
 		romdata->errorstring.catprintf(_("%s WRONG LENGTH (expected: %08x found: %08x)\n"), name, explength, actlength);
@@ -445,7 +449,7 @@ static void verify_length_and_hash(romload_private *romdata, const char *name, U
 
 	/* If there is no good dump known, write it */
 	astring tempstr;
-	hash_collection &acthashes = romdata->file->hashes(hashes.hash_types(tempstr));
+	hash_collection &acthashes = file->hashes(hashes.hash_types(tempstr));
 	if (hashes.flag(hash_collection::FLAG_NO_DUMP))
 	{
 		romdata->errorstring.catprintf(_("%s NO GOOD DUMP KNOWN\n"), name);
@@ -468,6 +472,95 @@ static void verify_length_and_hash(romload_private *romdata, const char *name, U
 }
 
 
+/*-------------------------------------------------
+    hash_file_callback - compute the checksums of
+    a fully loaded file on a work queue thread
+-------------------------------------------------*/
+
+static void *hash_file_callback(void *param, int threadid)
+{
+	romload_verify *verify = (romload_verify *)param;
+	verify->file->hashes(verify->types);
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    finish_oldest_verify - wait for the checksums
+    of the oldest pending file, then verify and
+    close it
+-------------------------------------------------*/
+
+static void finish_oldest_verify(romload_private *romdata)
+{
+	romload_verify &verify = romdata->verify[romdata->verifyhead];
+	osd_ticks_t start = osd_ticks();
+
+	/* wait for the background hash to finish */
+	if (verify.item != NULL)
+	{
+		while (!osd_work_item_wait(verify.item, osd_ticks_per_second()))
+			;
+		osd_work_item_release(verify.item);
+		verify.item = NULL;
+	}
+
+	/* verify exactly as if we had done it inline */
+	LOG(("Verifying length (%X) and checksums\n", verify.explength));
+	verify_length_and_hash(romdata, verify.file, ROM_GETNAME(verify.romp), verify.explength, hash_collection(ROM_GETHASHDATA(verify.romp)));
+	LOG(("Verify finished\n"));
+	romdata->hashticks += osd_ticks() - start;
+
+	/* close the file */
+	LOG(("Closing ROM file\n"));
+	global_free(verify.file);
+	verify.file = NULL;
+
+	romdata->verifyhead = (romdata->verifyhead + 1) % ROMLOAD_MAX_PENDING_VERIFY;
+	romdata->verifycount--;
+}
+
+
+/*-------------------------------------------------
+    flush_pending_verifies - verify and close all
+    files still waiting on their checksums
+-------------------------------------------------*/
+
+static void flush_pending_verifies(romload_private *romdata)
+{
+	while (romdata->verifycount > 0)
+		finish_oldest_verify(romdata);
+}
+
+
+/*-------------------------------------------------
+    queue_verify - take ownership of a file that
+    has been completely read and start computing
+    its checksums in the background; results are
+    reported in load order
+-------------------------------------------------*/
+
+static void queue_verify(romload_private *romdata, emu_file *file, const rom_entry *romp, UINT32 explength)
+{
+	/* make room if we're full */
+	if (romdata->verifycount == ROMLOAD_MAX_PENDING_VERIFY)
+		finish_oldest_verify(romdata);
+
+	romload_verify &verify = romdata->verify[(romdata->verifyhead + romdata->verifycount) % ROMLOAD_MAX_PENDING_VERIFY];
+	verify.file = file;
+	verify.romp = romp;
+	verify.explength = explength;
+	hash_collection(ROM_GETHASHDATA(romp)).hash_types(verify.types);
+
+	/* the file has already been decompressed by the seek back to the start,
+	   so hashing it only touches this file's own data */
+	verify.item = NULL;
+	if (romdata->hash_queue != NULL)
+		verify.item = osd_work_item_queue(romdata->hash_queue, hash_file_callback, &verify, 0);
+	romdata->verifycount++;
+}
+
+
 /*-------------------------------------------------
     display_loading_rom_message - display
     messages about ROM loading to the user
@@ -920,13 +1013,19 @@ static void process_rom_entries(romload_private *romdata, const char *regiontag,
 		{
 			int irrelevantbios = (ROM_GETBIOSFLAGS(romp) != 0 && ROM_GETBIOSFLAGS(romp) != device->system_bios());
 			const rom_entry *baserom = romp;
+			const rom_entry *verifyrom = romp;
 			int explength = 0;
+			int verifylength = 0;
 
 			/* open the file if it is a non-BIOS or matches the current BIOS */
 			LOG(("Opening ROM file: %s\n", ROM_GETNAME(romp)));
 			astring tried_file_names;
 			if (!irrelevantbios && !open_rom_file(romdata, regiontag, romp, tried_file_names))
+			{
+				/* keep the messages in load order */
+				flush_pending_verifies(romdata);
 				handle_missing_file(romdata, romp, tried_file_names);
+			}
 
 			/* loop until we run out of reloads */
 			do
@@ -951,13 +1050,9 @@ static void process_rom_entries(romload_private *romdata, const char *regiontag,
 				}
 				while (ROMENTRY_ISCONTINUE(romp) || ROMENTRY_ISIGNORE(romp));
 
-				/* if this was the first use of this file, verify the length and CRC */
+				/* if this was the first use of this file, remember the length to verify */
 				if (baserom)
-				{
-					LOG(("Verifying length (%X) and checksums\n", explength));
-					verify_length_and_hash(romdata, ROM_GETNAME(baserom), explength, hash_collection(ROM_GETHASHDATA(baserom)));
-					LOG(("Verify finished\n"));
-				}
+					verifylength = explength;
 
 				/* reseek to the start and clear the baserom so we don't reverify */
 				if (romdata->file != NULL)
@@ -967,11 +1062,10 @@ static void process_rom_entries(romload_private *romdata, const char *regiontag,
 			}
 			while (ROMENTRY_ISRELOAD(romp));
 
-			/* close the file */
+			/* hand the file off to be verified and closed once its checksums are ready */
 			if (romdata->file != NULL)
 			{
-				LOG(("Closing ROM file\n"));
-				global_free(romdata->file);
+				queue_verify(romdata, romdata->file, verifyrom, verifylength);
 				romdata->file = NULL;
 			}
 		}
@@ -1182,6 +1276,9 @@ static chd_error open_disk_diff(emu_options &options, const rom_entry *romp, chd
 
 static void process_disk_entries(romload_private *romdata, const char *regiontag, const rom_entry *parent_region, const rom_entry *romp, const char *locationtag)
 {
+	/* report any ROMs still being verified first */
+	flush_pending_verifies(romdata);
+
 	/* loop until we hit the end of this region */
 	for ( ; !ROMENTRY_ISREGIONEND(romp); romp++)
 	{
@@ -1403,6 +1500,9 @@ void load_software_part_region(device_t *device, char *swlist, char *swname, rom
 			process_disk_entries(romdata, core_strdup(regiontag.cstr()), region, region + 1, locationtag);
 	}
 
+	/* finish verifying any ROMs still in flight */
+	flush_pending_verifies(romdata);
+
 	/* now go back and post-process all the regions */
 	for (region = start_region; region != NULL; region = rom_next_region(region)) {
 		device->subtag(regiontag, ROMREGION_GETTAG(region));
@@ -1414,6 +1514,80 @@ void load_software_part_region(device_t *device, char *swlist, char *swname, rom
 }
 
 
+/*-------------------------------------------------
+    share_region - back a loaded region with a
+    copy-on-write mapping of a file holding the
+    same data, so that other instances running
+    the same game share its memory
+-------------------------------------------------*/
+
+static void share_region(romload_private *romdata, memory_region *region)
+{
+	running_machine &machine = romdata->machine();
+	if (region == NULL || region->bytes() < SHARED_REGION_MIN_SIZE || region->mapped())
+		return;
+
+	/* the file is named after the contents, so a name only ever refers to one set of data */
+	astring filename(region->name());
+	filename.replacechr(':', '_');
+	filename.catprintf("-%08x", (UINT32)crc32_creator::simple(region->base(), region->bytes()));
+
+	emu_file file(machine.options().cache_directory(), OPEN_FLAG_READ);
+	file_error filerr = file.open(machine.system().name, PATH_SEPARATOR, filename, ".rgn");
+	astring path;
+	if (filerr == FILERR_NONE && file.size() == region->bytes())
+		path.cpy(file.fullpath());
+	file.close();
+
+	/* first time we've seen this data (or the file is damaged); write a private copy and move it into place */
+	if (path.len() == 0)
+	{
+		/* never open an existing file for writing: another instance may have it mapped */
+		astring tempname;
+		for (UINT64 stamp = osd_ticks(); ; stamp++)
+		{
+			tempname.printf("%s.rgn.%08x%08x.tmp", filename.cstr(), (UINT32)(stamp >> 32), (UINT32)stamp);
+			emu_file probe(machine.options().cache_directory(), OPEN_FLAG_READ);
+			if (probe.open(machine.system().name, PATH_SEPARATOR, tempname.cstr()) != FILERR_NONE)
+				break;
+		}
+
+		emu_file newfile(machine.options().cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (newfile.open(machine.system().name, PATH_SEPARATOR, tempname.cstr()) != FILERR_NONE)
+			return;
+		if (newfile.write(region->base(), region->bytes()) != region->bytes())
+		{
+			newfile.remove_on_close();
+			return;
+		}
+		astring temppath(newfile.fullpath());
+		newfile.close();
+
+		/* the final name is the temporary one without its unique suffix */
+		path.cpy(temppath, temppath.len() - (tempname.len() - filename.len() - 4));
+		if (osd_rename(temppath, path) != FILERR_NONE)
+		{
+			osd_rmfile(temppath);
+			return;
+		}
+	}
+
+	/* only switch over if the file really holds what we loaded */
+	UINT64 maplength;
+	void *mapping = osd_map_file_private(path, &maplength);
+	if (mapping == NULL)
+		return;
+	if (maplength != region->bytes() || memcmp(mapping, region->base(), region->bytes()) != 0)
+	{
+		osd_unmap_file(mapping, maplength);
+		return;
+	}
+
+	region->attach_mapping(mapping, maplength);
+	mame_printf_verbose("Region '%s' shared from %s\n", region->name(), path.cstr());
+}
+
+
 /*-------------------------------------------------
     process_region_list - process a region list
 -------------------------------------------------*/
@@ -1421,6 +1595,7 @@ void load_software_part_region(device_t *device, char *swlist, char *swname, rom
 static void process_region_list(romload_private *romdata)
 {
 	astring regiontag;
+	osd_ticks_t start = osd_ticks();
 
 	/* loop until we hit the end */
 	device_iterator deviter(romdata->machine().root_device());
@@ -1468,13 +1643,29 @@ static void process_region_list(romload_private *romdata)
 				process_disk_entries(romdata, regiontag, region, region + 1, NULL);
 		}
 
+	/* finish verifying any ROMs still in flight */
+	flush_pending_verifies(romdata);
+	romdata->loadticks += osd_ticks() - start;
+
 	/* now go back and post-process all the regions */
+	start = osd_ticks();
 	for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
 		for (const rom_entry *region = rom_first_region(*device); region != NULL; region = rom_next_region(region))
 		{
 			rom_region_name(regiontag, *device, region);
 			region_post_process(romdata, regiontag, ROMREGION_ISINVERTED(region));
 		}
+
+	/* finally, share the large regions between instances if requested; nothing has taken a pointer into them yet */
+	if (romdata->machine().options().share_regions())
+		for (device_t *device = deviter.first(); device != NULL; device = deviter.next())
+			for (const rom_entry *region = rom_first_region(*device); region != NULL; region = rom_next_region(region))
+				if (ROMREGION_ISROMDATA(region))
+				{
+					rom_region_name(regiontag, *device, region);
+					share_region(romdata, romdata->machine().root_device().memregion(regiontag));
+				}
+	romdata->postticks += osd_ticks() - start;
 }
 
 
@@ -1520,6 +1711,9 @@ void rom_init(running_machine &machine)
 	/* reset the disk list */
 	romdata->chd_list.reset();
 
+	/* checksums are computed in the background while the next file loads */
+	romdata->hash_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 #ifdef USE_IPS
 	if (patchname && *patchname)
 	{
@@ -1534,6 +1728,14 @@ void rom_init(running_machine &machine)
 	/* process the ROM entries we were passed */
 	process_region_list(romdata);
 
+	/* solid 7z blocks are kept decompressed only while the ROMs load */
+	_7z_file_cache_clear();
+
+	double tps = (double)osd_ticks_per_second();
+	mame_printf_verbose("ROM load: %d files (%u bytes) in %.3fs, %.3fs of it waiting on checksums; post-processing %.3fs\n",
+			romdata->romsloaded, romdata->romsloadedsize, (double)romdata->loadticks / tps,
+			(double)romdata->hashticks / tps, (double)romdata->postticks / tps);
+
 #ifdef USE_IPS
 	if (patchname && *patchname)
 	{
@@ -1556,6 +1758,27 @@ void rom_init(running_machine &machine)
 
 static void rom_exit(running_machine &machine)
 {
+	romload_private *romdata = machine.romload_data;
+	if (romdata == NULL)
+		return;
+
+	/* drop anything left pending by an aborted load */
+	for ( ; romdata->verifycount > 0; romdata->verifycount--)
+	{
+		romload_verify &verify = romdata->verify[romdata->verifyhead];
+		if (verify.item != NULL)
+		{
+			while (!osd_work_item_wait(verify.item, osd_ticks_per_second()))
+				;
+			osd_work_item_release(verify.item);
+		}
+		global_free(verify.file);
+		romdata->verifyhead = (romdata->verifyhead + 1) % ROMLOAD_MAX_PENDING_VERIFY;
+	}
+
+	if (romdata->hash_queue != NULL)
+		osd_work_queue_free(romdata->hash_queue);
+	romdata->hash_queue = NULL;
 }
 
 
@@ -1589,3 +1812,129 @@ int rom_load_knownbad(running_machine &machine)
 {
 	return machine.romload_data->knownbad;
 }
+
+
+/***************************************************************************
+    DECRYPTED DATA CACHE
+***************************************************************************/
+
+/* cache files are a small native-endian header followed by the raw data */
+static const char rom_cache_magic[8] = { 'M','A','M','E','R','O','M','C' };
+
+struct rom_cache_header
+{
+	char            magic[8];           /* rom_cache_magic */
+	UINT32          key;                /* CRC of the undecrypted source data */
+	UINT32          length;             /* length of the data that follows */
+	UINT32          build;              /* CRC of the version and stamp of the build that wrote it */
+	UINT32          datacrc;            /* CRC of the data that follows */
+};
+
+
+/*-------------------------------------------------
+    rom_cache_build - identify the exact build,
+    so a rebuild never trusts an older entry
+-------------------------------------------------*/
+
+static UINT32 rom_cache_build()
+{
+	crc32_creator crc;
+	crc.append(build_version, strlen(build_version));
+	crc.append(build_stamp, strlen(build_stamp));
+	return crc.finish();
+}
+
+
+/*-------------------------------------------------
+    rom_cache_open - open the cache file for the
+    given name in the current driver's directory
+-------------------------------------------------*/
+
+static file_error rom_cache_open(running_machine &machine, const char *name, emu_file &file)
+{
+	return file.open(machine.system().name, PATH_SEPARATOR, name, ".bin");
+}
+
+
+/*-------------------------------------------------
+    rom_cache_key - compute the key identifying
+    the source data; 0 means caching is off
+-------------------------------------------------*/
+
+UINT32 rom_cache_key(running_machine &machine, const void *data, UINT32 length)
+{
+	if (!machine.options().rom_cache())
+		return 0;
+
+	/* reserve 0 for "disabled" */
+	UINT32 key = crc32_creator::simple(data, length);
+	return (key != 0) ? key : 1;
+}
+
+
+/*-------------------------------------------------
+    rom_cache_load - fill the destination from the
+    cache if an entry for this source data, length
+    and build exists and is intact
+-------------------------------------------------*/
+
+bool rom_cache_load(running_machine &machine, const char *name, UINT32 key, void *dest, UINT32 length)
+{
+	if (key == 0)
+		return false;
+
+	emu_file file(machine.options().cache_directory(), OPEN_FLAG_READ);
+	if (rom_cache_open(machine, name, file) != FILERR_NONE)
+		return false;
+
+	/* the header must match exactly */
+	rom_cache_header header;
+	if (file.read(&header, sizeof(header)) != sizeof(header) ||
+		memcmp(header.magic, rom_cache_magic, sizeof(header.magic)) != 0 ||
+		header.key != key || header.length != length ||
+		header.build != rom_cache_build() ||
+		file.size() != sizeof(header) + length)
+		return false;
+
+	/* read into a temporary buffer so a damaged file can't clobber the source */
+	dynamic_buffer buffer(length);
+	if (file.read(buffer, length) != length || crc32_creator::simple(buffer, length) != header.datacrc)
+		return false;
+
+	memcpy(dest, buffer, length);
+	mame_printf_verbose("Loaded %s from the ROM cache\n", name);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    rom_cache_save - write decrypted data to the
+    cache under the given key
+-------------------------------------------------*/
+
+void rom_cache_save(running_machine &machine, const char *name, UINT32 key, const void *data, UINT32 length)
+{
+	if (key == 0)
+		return;
+
+	emu_file file(machine.options().cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (rom_cache_open(machine, name, file) != FILERR_NONE)
+	{
+		mame_printf_verbose("Unable to write %s to the ROM cache\n", name);
+		return;
+	}
+
+	rom_cache_header header;
+	memcpy(header.magic, rom_cache_magic, sizeof(header.magic));
+	header.key = key;
+	header.length = length;
+	header.build = rom_cache_build();
+	header.datacrc = crc32_creator::simple(data, length);
+
+	if (file.write(&header, sizeof(header)) != sizeof(header) || file.write(data, length) != length)
+	{
+		/* don't leave a partial entry behind */
+		file.remove_on_close();
+		mame_printf_verbose("Unable to write %s to the ROM cache\n", name);
+	}
+}
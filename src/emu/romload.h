@@ -160,6 +160,19 @@ private:
 };
 
 
+/* number of files whose checksums may be computed in the background at once */
+#define ROMLOAD_MAX_PENDING_VERIFY  4
+
+struct romload_verify
+{
+	emu_file *      file;               /* file being verified; owned until verified */
+	const rom_entry *romp;              /* entry holding the name and expected hashes */
+	UINT32          explength;          /* expected length of the file */
+	astring         types;              /* hash types to compute */
+	osd_work_item * item;               /* background hashing work item, if any */
+};
+
+
 struct romload_private
 {
 	running_machine &machine() const { assert(m_machine != NULL); return *m_machine; }
@@ -185,6 +198,15 @@ struct romload_private
 
 	astring         errorstring;        /* error string */
 	astring         softwarningstring;  /* software warning string */
+
+	osd_work_queue *hash_queue;         /* queue for hashing loaded files in the background */
+	romload_verify  verify[ROMLOAD_MAX_PENDING_VERIFY]; /* files awaiting verification, oldest first */
+	int             verifyhead;         /* index of the oldest pending verification */
+	int             verifycount;        /* number of pending verifications */
+
+	osd_ticks_t     loadticks;          /* time spent opening and reading files */
+	osd_ticks_t     hashticks;          /* time spent waiting on checksums */
+	osd_ticks_t     postticks;          /* time spent post-processing regions */
 };
 
 
@@ -363,4 +385,17 @@ int set_disk_handle(running_machine &machine, const char *region, const char *fu
 
 void load_software_part_region(device_t *device, char *swlist, char *swname, rom_entry *start_region);
 
+
+
+/* ----- decrypted data cache ----- */
+
+/* compute the cache key for the undecrypted source data; returns 0 if -rom_cache is off */
+UINT32 rom_cache_key(running_machine &machine, const void *data, UINT32 length);
+
+/* fill the destination from the cache if a matching entry exists */
+bool rom_cache_load(running_machine &machine, const char *name, UINT32 key, void *dest, UINT32 length);
+
+/* store decrypted data in the cache under the given key */
+void rom_cache_save(running_machine &machine, const char *name, UINT32 key, const void *data, UINT32 length);
+
 #endif  /* __ROMLOAD_H__ */
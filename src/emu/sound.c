@@ -43,6 +43,10 @@
 #include "config.h"
 #include "sound/wavwrite.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 
 
 //**************************************************************************
@@ -69,6 +73,61 @@ const attotime sound_manager::STREAMS_UPDATE_ATTOTIME = attotime::from_hz(STREAM
 
 
 
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  apply_gain - copy a run of samples, scaling
+//  by an 8.8 fixed point gain
+//-------------------------------------------------
+
+static void apply_gain(stream_sample_t *dest, const stream_sample_t *source, int gain, int numsamples)
+{
+#ifdef __SSE2__
+	// SSE2 has no 32-bit multiply-low, so build it from the even and odd 32x32->64 products
+	const __m128i vgain = _mm_set1_epi32(gain);
+	for ( ; numsamples >= 4; numsamples -= 4, source += 4, dest += 4)
+	{
+		__m128i samples = _mm_loadu_si128((const __m128i *)source);
+		__m128i even = _mm_mul_epu32(samples, vgain);
+		__m128i odd = _mm_mul_epu32(_mm_srli_epi64(samples, 32), vgain);
+		__m128i product = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0,0,2,0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0,0,2,0)));
+		_mm_storeu_si128((__m128i *)dest, _mm_srai_epi32(product, 8));
+	}
+#endif
+	while (numsamples-- > 0)
+		*dest++ = (*source++ * gain) >> 8;
+}
+
+
+//-------------------------------------------------
+//  clamp_mix - clamp the left and right mix
+//  buffers to 16 bits and interleave them
+//-------------------------------------------------
+
+static void clamp_mix(INT16 *dest, const INT32 *left, const INT32 *right, int numsamples)
+{
+#ifdef __SSE2__
+	// saturating packs clamp exactly like the scalar code
+	for ( ; numsamples >= 4; numsamples -= 4, left += 4, right += 4, dest += 8)
+	{
+		__m128i l = _mm_loadu_si128((const __m128i *)left);
+		__m128i r = _mm_loadu_si128((const __m128i *)right);
+		_mm_storeu_si128((__m128i *)dest, _mm_unpacklo_epi16(_mm_packs_epi32(l, l), _mm_packs_epi32(r, r)));
+	}
+#endif
+	while (numsamples-- > 0)
+	{
+		INT32 samp = *left++;
+		*dest++ = (samp < -32768) ? -32768 : (samp > 32767) ? 32767 : samp;
+		samp = *right++;
+		*dest++ = (samp < -32768) ? -32768 : (samp > 32767) ? 32767 : samp;
+	}
+}
+
+
+
 //**************************************************************************
 //  INITIALIZATION
 //**************************************************************************
@@ -94,7 +153,9 @@ sound_stream::sound_stream(device_t &device, int inputs, int outputs, int sample
 		m_output_update_sampindex(0),
 		m_output_base_sampindex(0),
 		m_callback(callback),
-		m_param(param)
+		m_param(param),
+		m_write_queue(0),
+		m_independent(false)
 {
 	// get the device's sound interface
 	device_sound_interface *sound;
@@ -109,6 +170,7 @@ sound_stream::sound_stream(device_t &device, int inputs, int outputs, int sample
 	astring state_tag;
 	state_tag.printf("%d", m_device.machine().sound().m_stream_list.count());
 	m_device.machine().save().save_item("stream", state_tag, 0, NAME(m_sample_rate));
+	m_device.machine().save().register_presave(save_prepost_delegate(FUNC(sound_stream::presave), this));
 	m_device.machine().save().register_postload(save_prepost_delegate(FUNC(sound_stream::postload), this));
 
 	// save the gain of each input and output
@@ -270,6 +332,9 @@ void sound_stream::set_input(int index, sound_stream *input_stream, int output_i
 	if (input.m_source != NULL)
 		input.m_source->m_dependents++;
 
+	// the set of leaf streams may have changed
+	m_device.machine().sound().m_leaf_groups_dirty = true;
+
 	// update sample rates now that we know the input
 	recompute_sample_rate_data();
 }
@@ -305,11 +370,60 @@ void sound_stream::update()
 	g_profiler.start(PROFILER_SOUND);
 	assert(m_output_sampindex - m_output_base_sampindex >= 0);
 	assert(update_sampindex - m_output_base_sampindex <= m_output_bufalloc);
-	generate_samples(update_sampindex - m_output_sampindex);
+	generate_to(update_sampindex);
 	g_profiler.stop();
+}
 
-	// remember this info for next time
-	m_output_sampindex = update_sampindex;
+
+//-------------------------------------------------
+//  update_samples - same as update, but without
+//  touching the profiler so it can run on a
+//  worker thread
+//-------------------------------------------------
+
+void sound_stream::update_samples()
+{
+	generate_to(current_sampindex());
+}
+
+
+//-------------------------------------------------
+//  queue_write - apply a register write to the
+//  stream's device once the stream has rendered
+//  up to the current time; with deferral off the
+//  stream is brought up to date and the write
+//  applied immediately
+//-------------------------------------------------
+
+void sound_stream::queue_write(stream_write_func func, offs_t offset, UINT8 data)
+{
+	if (!m_device.machine().sound().defer_writes())
+	{
+		update();
+		(*func)(&m_device, offset, data);
+		return;
+	}
+
+	stream_write write;
+	write.m_sampindex = current_sampindex();
+	write.m_func = func;
+	write.m_offset = offset;
+	write.m_data = data;
+	m_write_queue.append(write);
+}
+
+
+//-------------------------------------------------
+//  is_leaf - true if this stream does not pull
+//  from any other stream
+//-------------------------------------------------
+
+bool sound_stream::is_leaf() const
+{
+	for (int inputnum = 0; inputnum < m_input.count(); inputnum++)
+		if (m_input[inputnum].m_source != NULL)
+			return false;
+	return true;
 }
 
 
@@ -382,6 +496,21 @@ void sound_stream::set_output_gain(int outputnum, float gain)
 }
 
 
+//-------------------------------------------------
+//  set_independent - mark the stream's update
+//  callback as touching nothing outside its own
+//  device (no timers, no other devices, no
+//  shared memory writes), allowing it to render
+//  on a worker thread
+//-------------------------------------------------
+
+void sound_stream::set_independent(bool independent)
+{
+	m_independent = independent;
+	m_device.machine().sound().m_leaf_groups_dirty = true;
+}
+
+
 //-------------------------------------------------
 //  update_with_accounting - do a regular update,
 //  but also do periodic accounting
@@ -399,6 +528,8 @@ void sound_stream::update_with_accounting(bool second_tick)
 	{
 		m_output_sampindex -= m_sample_rate;
 		m_output_base_sampindex -= m_sample_rate;
+		for (int index = 0; index < m_write_queue.count(); index++)
+			m_write_queue[index].m_sampindex -= m_sample_rate;
 	}
 
 	// note our current output sample
@@ -569,6 +700,18 @@ void sound_stream::allocate_output_buffers()
 }
 
 
+//-------------------------------------------------
+//  presave - save/restore callback
+//-------------------------------------------------
+
+void sound_stream::presave()
+{
+	// queued writes are not part of the saved state, so apply them now
+	if (m_write_queue.count() != 0)
+		update();
+}
+
+
 //-------------------------------------------------
 //  postload - save/restore callback
 //-------------------------------------------------
@@ -586,6 +729,71 @@ void sound_stream::postload()
 	m_output_sampindex = m_device.machine().sound().last_update().attoseconds / m_attoseconds_per_sample;
 	m_output_update_sampindex = m_output_sampindex;
 	m_output_base_sampindex = m_output_sampindex - m_max_samples_per_update;
+
+	// writes queued before the load belong to the old timeline
+	m_write_queue.resize(0);
+}
+
+
+//-------------------------------------------------
+//  current_sampindex - return the sample index
+//  of the current emulated time, relative to the
+//  second of the last global update
+//-------------------------------------------------
+
+INT32 sound_stream::current_sampindex() const
+{
+	// determine the number of samples since the start of this second
+	attotime time = m_device.machine().time();
+	INT32 sampindex = INT32(time.attoseconds / m_attoseconds_per_sample);
+
+	// adjust for the global update being in a different second
+	attotime last_update = m_device.machine().sound().last_update();
+	if (time.seconds > last_update.seconds)
+		sampindex += m_sample_rate;
+	if (time.seconds < last_update.seconds)
+		sampindex -= m_sample_rate;
+	return sampindex;
+}
+
+
+//-------------------------------------------------
+//  generate_to - generate samples up to the given
+//  index, applying any queued register writes at
+//  the samples where they were made
+//-------------------------------------------------
+
+void sound_stream::generate_to(INT32 update_sampindex)
+{
+	// writes are queued in time order, so render up to each in turn
+	int applied;
+	for (applied = 0; applied < m_write_queue.count(); applied++)
+	{
+		stream_write &write = m_write_queue[applied];
+
+		// a CPU running ahead of the update time may have queued writes beyond it
+		if (write.m_sampindex > update_sampindex)
+			break;
+		if (write.m_sampindex > m_output_sampindex)
+		{
+			generate_samples(write.m_sampindex - m_output_sampindex);
+			m_output_sampindex = write.m_sampindex;
+		}
+		(*write.m_func)(&m_device, write.m_offset, write.m_data);
+	}
+
+	// keep whatever is still ahead of us
+	if (applied != 0)
+	{
+		int remaining = m_write_queue.count() - applied;
+		for (int index = 0; index < remaining; index++)
+			m_write_queue[index] = m_write_queue[applied + index];
+		m_write_queue.resize(remaining, true);
+	}
+
+	// generate samples to get us up to the appropriate time
+	generate_samples(update_sampindex - m_output_sampindex);
+	m_output_sampindex = update_sampindex;
 }
 
 
@@ -675,14 +883,7 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, UINT
 
 	// if we have equal sample rates, we just need to copy
 	if (step == FRAC_ONE)
-	{
-		while (numsamples--)
-		{
-			// compute the sample
-			stream_sample_t sample = *source++;
-			*dest++ = (sample * gain) >> 8;
-		}
-	}
+		apply_gain(dest, source, gain, numsamples);
 
 	// input is undersampled: point sample except where our sample period covers a boundary
 	else if (step < FRAC_ONE)
@@ -803,9 +1004,12 @@ sound_manager::sound_manager(running_machine &machine)
 		m_muted(0),
 		m_attenuation(0),
 		m_nosound_mode(!machine.options().sound()),
+		m_defer_writes(machine.options().defer_sound_writes()),
 		m_wavfile(NULL),
 		m_update_attoseconds(STREAMS_UPDATE_ATTOTIME.attoseconds),
-		m_last_update(attotime::zero)
+		m_last_update(attotime::zero),
+		m_update_queue(NULL),
+		m_leaf_groups_dirty(true)
 {
 	// get filename for WAV file or AVI file if specified
 	const char *wavfile = machine.options().wav_write();
@@ -840,6 +1044,9 @@ sound_manager::sound_manager(running_machine &machine)
 	// start the periodic update flushing timer
 	m_update_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(sound_manager::update), this));
 	m_update_timer->adjust(STREAMS_UPDATE_ATTOTIME, 0, STREAMS_UPDATE_ATTOTIME);
+
+	// independent chips are rendered in parallel
+	m_update_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 }
 
 
@@ -853,6 +1060,10 @@ sound_manager::~sound_manager()
 	if (m_wavfile != NULL)
 		wav_close(m_wavfile);
 	m_wavfile = NULL;
+
+	// free the work queue
+	if (m_update_queue != NULL)
+		osd_work_queue_free(m_update_queue);
 }
 
 
@@ -862,6 +1073,7 @@ sound_manager::~sound_manager()
 
 sound_stream *sound_manager::stream_alloc(device_t &device, int inputs, int outputs, int sample_rate, void *param, sound_stream::stream_update_func callback)
 {
+	m_leaf_groups_dirty = true;
 	if (callback != NULL)
 		return &m_stream_list.append(*global_alloc(sound_stream(device, inputs, outputs, sample_rate, param, callback)));
 	else
@@ -1027,6 +1239,9 @@ void sound_manager::update(void *ptr, int param)
 
 	g_profiler.start(PROFILER_SOUND);
 
+	// render the independent streams that depend on nothing else first, in parallel
+	update_leaf_streams();
+
 	// force all the speaker streams to generate the proper number of samples
 	int samples_this_update = 0;
 	speaker_device_iterator iter(machine().root_device());
@@ -1037,28 +1252,38 @@ void sound_manager::update(void *ptr, int param)
 	UINT32 finalmix_step = machine().video().speed_factor();
 	UINT32 finalmix_offset = 0;
 	INT16 *finalmix = m_finalmix;
-	int sample;
-	for (sample = m_finalmix_leftover; sample < samples_this_update * 1000; sample += finalmix_step)
+
+	// at normal speed every sample is used once, so the clamp can run in bulk
+	if (finalmix_step == 1000 && m_finalmix_leftover < 1000)
 	{
-		int sampindex = sample / 1000;
-
-		// clamp the left side
-		INT32 samp = m_leftmix[sampindex];
-		if (samp < -32768)
-			samp = -32768;
-		else if (samp > 32767)
-			samp = 32767;
-		finalmix[finalmix_offset++] = samp;
-
-		// clamp the right side
-		samp = m_rightmix[sampindex];
-		if (samp < -32768)
-			samp = -32768;
-		else if (samp > 32767)
-			samp = 32767;
-		finalmix[finalmix_offset++] = samp;
+		clamp_mix(finalmix, m_leftmix, m_rightmix, samples_this_update);
+		finalmix_offset = samples_this_update * 2;
+	}
+	else
+	{
+		int sample;
+		for (sample = m_finalmix_leftover; sample < samples_this_update * 1000; sample += finalmix_step)
+		{
+			int sampindex = sample / 1000;
+
+			// clamp the left side
+			INT32 samp = m_leftmix[sampindex];
+			if (samp < -32768)
+				samp = -32768;
+			else if (samp > 32767)
+				samp = 32767;
+			finalmix[finalmix_offset++] = samp;
+
+			// clamp the right side
+			samp = m_rightmix[sampindex];
+			if (samp < -32768)
+				samp = -32768;
+			else if (samp > 32767)
+				samp = 32767;
+			finalmix[finalmix_offset++] = samp;
+		}
+		m_finalmix_leftover = sample - samples_this_update * 1000;
 	}
-	m_finalmix_leftover = sample - samples_this_update * 1000;
 
 	// play the result
 	if (finalmix_offset > 0)
@@ -1092,3 +1317,85 @@ void sound_manager::update(void *ptr, int param)
 
 	g_profiler.stop();
 }
+
+
+//-------------------------------------------------
+//  update_leaf_streams - bring every independent
+//  stream that has no stream inputs up to date,
+//  with the streams of different devices rendered
+//  in parallel; the speakers then find them
+//  current
+//-------------------------------------------------
+
+void sound_manager::update_leaf_streams()
+{
+	if (m_update_queue == NULL)
+		return;
+
+	// regroup only when streams have been added or rewired
+	if (m_leaf_groups_dirty)
+		build_leaf_groups();
+
+	// nothing to gain with a single device
+	if (m_leaf_group.count() < 2)
+		return;
+
+	osd_work_item_queue_multiple(m_update_queue, update_leaf_group, m_leaf_group.count(), &m_leaf_group[0], sizeof(stream_group), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_update_queue, osd_ticks_per_second() * 10);
+}
+
+
+//-------------------------------------------------
+//  build_leaf_groups - gather the independent
+//  leaf streams, one group per device since the
+//  streams of one device may share state
+//-------------------------------------------------
+
+void sound_manager::build_leaf_groups()
+{
+	m_leaf_stream.resize(0);
+	m_leaf_group.resize(0);
+	for (sound_stream *stream = m_stream_list.first(); stream != NULL; stream = stream->next())
+	{
+		if (!stream->m_independent || !stream->is_leaf())
+			continue;
+
+		// skip devices we have already grouped
+		bool grouped = false;
+		for (int index = 0; index < m_leaf_stream.count() && !grouped; index++)
+			grouped = (&m_leaf_stream[index]->device() == &stream->device());
+		if (grouped)
+			continue;
+
+		// add this stream and every later leaf stream of the same device
+		stream_group group;
+		group.stream = NULL;
+		group.count = 0;
+		for (sound_stream *other = stream; other != NULL; other = other->next())
+			if (&other->device() == &stream->device() && other->m_independent && other->is_leaf())
+			{
+				m_leaf_stream.append(other);
+				group.count++;
+			}
+		m_leaf_group.append(group);
+	}
+
+	// point the groups at their streams now that the array is complete
+	for (int groupnum = 0, index = 0; groupnum < m_leaf_group.count(); index += m_leaf_group[groupnum++].count)
+		m_leaf_group[groupnum].stream = &m_leaf_stream[index];
+	m_leaf_groups_dirty = false;
+}
+
+
+//-------------------------------------------------
+//  update_leaf_group - work item callback to
+//  update one device's leaf streams
+//-------------------------------------------------
+
+void *sound_manager::update_leaf_group(void *param, int threadid)
+{
+	stream_group &group = *(stream_group *)param;
+	for (int index = 0; index < group.count; index++)
+		group.stream[index]->update_samples();
+	return NULL;
+}
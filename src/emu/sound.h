@@ -80,6 +80,7 @@ class sound_stream
 	friend class sound_manager;
 
 	typedef void (*stream_update_func)(device_t *device, sound_stream *stream, void *param, stream_sample_t **inputs, stream_sample_t **outputs, int samples);
+	typedef void (*stream_write_func)(device_t *device, offs_t offset, UINT8 data);
 
 	// stream output class
 	class stream_output
@@ -112,6 +113,15 @@ class sound_stream
 		INT16               m_user_gain;            // user-controlled gain to apply to this input
 	};
 
+	// register write deferred until the stream renders past it
+	struct stream_write
+	{
+		INT32               m_sampindex;            // sample at which the write took effect
+		stream_write_func   m_func;                 // function that applies the write
+		offs_t              m_offset;               // register offset
+		UINT8               m_data;                 // register data
+	};
+
 	// constants
 	static const int OUTPUT_BUFFER_UPDATES      = 5;
 	static const UINT32 FRAC_BITS               = 22;
@@ -140,6 +150,7 @@ public:
 	// operations
 	void set_input(int inputnum, sound_stream *input_stream, int outputnum = 0, float gain = 1.0f);
 	void update();
+	void queue_write(stream_write_func func, offs_t offset, UINT8 data);
 	const stream_sample_t *output_since_last_update(int outputnum, int &numsamples);
 
 	// timing
@@ -147,9 +158,12 @@ public:
 	void set_user_gain(int inputnum, float gain);
 	void set_input_gain(int inputnum, float gain);
 	void set_output_gain(int outputnum, float gain);
+	void set_independent(bool independent = true);
 
 private:
 	// helpers called by our friends only
+	void update_samples();
+	bool is_leaf() const;
 	void update_with_accounting(bool second_tick);
 	void apply_sample_rate_changes();
 
@@ -158,7 +172,10 @@ private:
 	void recompute_sample_rate_data();
 	void allocate_resample_buffers();
 	void allocate_output_buffers();
+	void presave();
 	void postload();
+	INT32 current_sampindex() const;
+	void generate_to(INT32 update_sampindex);
 	void generate_samples(int samples);
 	stream_sample_t *generate_resampled_data(stream_input &input, UINT32 numsamples);
 
@@ -194,6 +211,12 @@ private:
 	// callback information
 	stream_update_func  m_callback;             // callback function
 	void *              m_param;                // callback function parameter
+
+	// deferred register writes
+	dynamic_array<stream_write> m_write_queue;  // writes waiting for the stream to reach them
+
+	// parallel rendering
+	bool                m_independent;          // update callback touches only its own device
 };
 
 
@@ -224,6 +247,7 @@ public:
 	int attenuation() const { return m_attenuation; }
 	sound_stream *first_stream() const { return m_stream_list.first(); }
 	attotime last_update() const { return m_last_update; }
+	bool defer_writes() const { return m_defer_writes; }
 	attoseconds_t update_attoseconds() const { return m_update_attoseconds; }
 
 	// stream creation
@@ -249,6 +273,16 @@ private:
 	void config_save(int config_type, xml_data_node *parentnode);
 
 	void update(void *ptr = NULL, INT32 param = 0);
+	void update_leaf_streams();
+	void build_leaf_groups();
+	static void *update_leaf_group(void *param, int threadid);
+
+	// a run of independent streams owned by one device
+	struct stream_group
+	{
+		sound_stream **     stream;                 // first stream in the group
+		int                 count;                  // number of streams
+	};
 
 	// internal state
 	running_machine &   m_machine;              // reference to our machine
@@ -262,6 +296,7 @@ private:
 	UINT8               m_muted;
 	int                 m_attenuation;
 	int                 m_nosound_mode;
+	bool                m_defer_writes;
 
 	wav_file *          m_wavfile;
 
@@ -269,6 +304,12 @@ private:
 	simple_list<sound_stream> m_stream_list;    // list of streams
 	attoseconds_t       m_update_attoseconds;   // attoseconds between global updates
 	attotime            m_last_update;          // last update time
+
+	// parallel stream rendering
+	osd_work_queue *    m_update_queue;         // queue for rendering independent streams
+	bool                m_leaf_groups_dirty;    // streams were added or rewired since the groups were built
+	dynamic_array<sound_stream *> m_leaf_stream; // independent streams with no stream inputs, grouped by device
+	dynamic_array<stream_group> m_leaf_group;   // groups of m_leaf_stream sharing a device
 };
 
 
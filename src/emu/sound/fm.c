@@ -1349,51 +1349,58 @@ INLINE void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 	UINT32 AM = OPN->LFO_AM >> CH->ams;
 
 
-	OPN->m2 = OPN->c1 = OPN->c2 = OPN->mem = 0;
-
-	*CH->mem_connect = CH->mem_value;   /* restore delayed sample (MEM) value to m2 or c2 */
-
-	eg_out = volume_calc(&CH->SLOT[SLOT1]);
+	/* a channel with every slot below audibility and no feedback or MEM
+	   history left produces nothing, so only its phases need to advance */
+	if (CH->SLOT[SLOT1].vol_out < ENV_QUIET || CH->SLOT[SLOT2].vol_out < ENV_QUIET ||
+		CH->SLOT[SLOT3].vol_out < ENV_QUIET || CH->SLOT[SLOT4].vol_out < ENV_QUIET ||
+		CH->op1_out[0] != 0 || CH->op1_out[1] != 0 || CH->mem_value != 0)
 	{
-		INT32 out = CH->op1_out[0] + CH->op1_out[1];
-		CH->op1_out[0] = CH->op1_out[1];
+		OPN->m2 = OPN->c1 = OPN->c2 = OPN->mem = 0;
 
-		if( !CH->connect1 )
-		{
-			/* algorithm 5  */
-			OPN->mem = OPN->c1 = OPN->c2 = CH->op1_out[0];
-		}
-		else
-		{
-			/* other algorithms */
-			*CH->connect1 += CH->op1_out[0];
-		}
+		*CH->mem_connect = CH->mem_value;   /* restore delayed sample (MEM) value to m2 or c2 */
 
-		CH->op1_out[1] = 0;
-		if( eg_out < ENV_QUIET )    /* SLOT 1 */
+		eg_out = volume_calc(&CH->SLOT[SLOT1]);
 		{
-			if (!CH->FB)
-				out=0;
+			INT32 out = CH->op1_out[0] + CH->op1_out[1];
+			CH->op1_out[0] = CH->op1_out[1];
+
+			if( !CH->connect1 )
+			{
+				/* algorithm 5  */
+				OPN->mem = OPN->c1 = OPN->c2 = CH->op1_out[0];
+			}
+			else
+			{
+				/* other algorithms */
+				*CH->connect1 += CH->op1_out[0];
+			}
 
-			CH->op1_out[1] = op_calc1(CH->SLOT[SLOT1].phase, eg_out, (out<<CH->FB) );
+			CH->op1_out[1] = 0;
+			if( eg_out < ENV_QUIET )    /* SLOT 1 */
+			{
+				if (!CH->FB)
+					out=0;
+
+				CH->op1_out[1] = op_calc1(CH->SLOT[SLOT1].phase, eg_out, (out<<CH->FB) );
+			}
 		}
-	}
 
-	eg_out = volume_calc(&CH->SLOT[SLOT3]);
-	if( eg_out < ENV_QUIET )        /* SLOT 3 */
-		*CH->connect3 += op_calc(CH->SLOT[SLOT3].phase, eg_out, OPN->m2);
+		eg_out = volume_calc(&CH->SLOT[SLOT3]);
+		if( eg_out < ENV_QUIET )        /* SLOT 3 */
+			*CH->connect3 += op_calc(CH->SLOT[SLOT3].phase, eg_out, OPN->m2);
 
-	eg_out = volume_calc(&CH->SLOT[SLOT2]);
-	if( eg_out < ENV_QUIET )        /* SLOT 2 */
-		*CH->connect2 += op_calc(CH->SLOT[SLOT2].phase, eg_out, OPN->c1);
+		eg_out = volume_calc(&CH->SLOT[SLOT2]);
+		if( eg_out < ENV_QUIET )        /* SLOT 2 */
+			*CH->connect2 += op_calc(CH->SLOT[SLOT2].phase, eg_out, OPN->c1);
 
-	eg_out = volume_calc(&CH->SLOT[SLOT4]);
-	if( eg_out < ENV_QUIET )        /* SLOT 4 */
-		*CH->connect4 += op_calc(CH->SLOT[SLOT4].phase, eg_out, OPN->c2);
+		eg_out = volume_calc(&CH->SLOT[SLOT4]);
+		if( eg_out < ENV_QUIET )        /* SLOT 4 */
+			*CH->connect4 += op_calc(CH->SLOT[SLOT4].phase, eg_out, OPN->c2);
 
 
-	/* store current MEM */
-	CH->mem_value = OPN->mem;
+		/* store current MEM */
+		CH->mem_value = OPN->mem;
+	}
 
 	/* update phase counters AFTER output calculations */
 	if(CH->pms)
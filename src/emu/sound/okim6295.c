@@ -36,8 +36,13 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "emuopts.h"
 #include "okim6295.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 
 //**************************************************************************
 //  GLOBAL VARIABLES
@@ -94,7 +99,9 @@ okim6295_device::okim6295_device(const machine_config &mconfig, const char *tag,
 		m_bank_offs(0),
 		m_stream(NULL),
 		m_pin7_state(0),
-		m_direct(NULL)
+		m_direct(NULL),
+		m_use_cache(false),
+		m_cache_bytes(0)
 {
 }
 
@@ -119,11 +126,15 @@ void okim6295_device::device_start()
 {
 	// find our direct access
 	m_direct = &space().direct();
+	m_use_cache = machine().options().adpcm_cache();
 
 	// create the stream
 	int divisor = m_pin7_state ? 132 : 165;
 	m_stream = machine().sound().stream_alloc(*this, 0, 1, clock() / divisor);
 
+	// the update only reads our own ROM space and voices, so it can render alongside other chips
+	m_stream->set_independent();
+
 	save_item(NAME(m_command));
 	save_item(NAME(m_bank_offs));
 	save_item(NAME(m_pin7_state));
@@ -153,12 +164,28 @@ void okim6295_device::device_reset()
 }
 
 
+//-------------------------------------------------
+//  device_pre_save - device-specific pre-save
+//-------------------------------------------------
+
+void okim6295_device::device_pre_save()
+{
+	// voices playing from the cache don't track the ADPCM state, so rebuild it
+	for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++)
+		m_voice[voicenum].leave_cache();
+}
+
+
 //-------------------------------------------------
 //  device_post_load - device-specific post-load
 //-------------------------------------------------
 
 void okim6295_device::device_post_load()
 {
+	// the restored ADPCM state is valid, so finish the loaded phrases by decoding
+	for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++)
+		m_voice[voicenum].m_cache = NULL;
+
 	set_bank_base(m_bank_offs, true);
 	device_clock_changed();
 }
@@ -216,6 +243,10 @@ void okim6295_device::set_bank_base(offs_t base, bool bDontUpdateStream)
 		m_stream->update();
 	}
 
+	// phrases in progress continue from the new bank, so stop using their decoded copies
+	for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++)
+		m_voice[voicenum].leave_cache();
+
 	// if we are setting a non-zero base, and we have no bank, allocate one
 	if (!m_bank_installed && base != 0)
 	{
@@ -322,6 +353,9 @@ void okim6295_device::write_command(UINT8 command)
 						// also reset the ADPCM parameters
 						voice.m_adpcm.reset();
 						voice.m_volume = s_volume_table[command & 0x0f];
+
+						// play from the decoded copy if we have or can make one
+						voice.m_cache = m_use_cache ? cached_phrase(start, stop) : NULL;
 					}
 
 					// invalid samples go here
@@ -369,6 +403,64 @@ WRITE8_MEMBER( okim6295_device::write )
 }
 
 
+//-------------------------------------------------
+//  contiguous_bytes - return a pointer to the
+//  bytes from start to stop if every 256-byte
+//  page between them is mapped contiguously, or
+//  NULL if not
+//-------------------------------------------------
+
+const UINT8 *okim6295_device::contiguous_bytes(direct_read_data &direct, offs_t start, offs_t stop)
+{
+	const UINT8 *base = (const UINT8 *)direct.read_raw_ptr(start);
+	if (base == NULL)
+		return NULL;
+	for (offs_t offs = (start | 0xff) + 1; offs <= stop; offs += 0x100)
+		if ((const UINT8 *)direct.read_raw_ptr(offs) != base + (offs - start))
+			return NULL;
+	return base;
+}
+
+
+//-------------------------------------------------
+//  cached_phrase - find or create the decoded
+//  PCM for a phrase; the ADPCM bytes are compared
+//  on every lookup, and the memory is checked
+//  again as each block of a phrase is mixed
+//-------------------------------------------------
+
+const okim6295_device::okim_cache_entry *okim6295_device::cached_phrase(offs_t start, offs_t stop)
+{
+	// only phrases that are contiguous in memory can be compared quickly
+	UINT32 bytes = stop - start + 1;
+	const UINT8 *base = contiguous_bytes(*m_direct, start, stop);
+	if (base == NULL)
+		return NULL;
+
+	// look for a match
+	for (okim_cache_entry *entry = m_cache.first(); entry != NULL; entry = entry->next())
+		if (entry->m_start == start && entry->m_raw.count() == bytes && memcmp(entry->m_raw, base, bytes) == 0)
+			return entry;
+
+	// don't grow without bound
+	UINT32 entrybytes = bytes * sizeof(UINT8) + 2 * bytes * sizeof(INT16);
+	if (m_cache_bytes + entrybytes > CACHE_MAX_BYTES)
+		return NULL;
+	m_cache_bytes += entrybytes;
+
+	// decode the whole phrase, high nibble first
+	okim_cache_entry &entry = m_cache.append(*global_alloc(okim_cache_entry));
+	entry.m_start = start;
+	entry.m_raw.resize(bytes);
+	memcpy(entry.m_raw, base, bytes);
+	entry.m_pcm.resize(2 * bytes);
+	oki_adpcm_state adpcm;
+	for (UINT32 sample = 0; sample < 2 * bytes; sample++)
+		entry.m_pcm[sample] = adpcm.clock(base[sample / 2] >> (((sample & 1) << 2) ^ 4));
+	return &entry;
+}
+
+
 
 //**************************************************************************
 //  OKIM VOICE
@@ -383,8 +475,51 @@ okim6295_device::okim_voice::okim_voice()
 		m_base_offset(0),
 		m_sample(0),
 		m_count(0),
-		m_volume(0)
+		m_volume(0),
+		m_cache(NULL)
+{
+}
+
+
+//-------------------------------------------------
+//  leave_cache - switch a voice playing from the
+//  cache back to decoding, rebuilding the ADPCM
+//  state it would have had
+//-------------------------------------------------
+
+void okim6295_device::okim_voice::leave_cache()
+{
+	if (m_cache != NULL && m_playing)
+	{
+		m_adpcm.reset();
+		for (UINT32 sample = 0; sample < m_sample; sample++)
+			m_adpcm.clock(m_cache->m_raw[sample / 2] >> (((sample & 1) << 2) ^ 4));
+	}
+	m_cache = NULL;
+}
+
+
+//-------------------------------------------------
+//  mix_pcm - add decoded samples to a buffer,
+//  scaled by the voice volume
+//-------------------------------------------------
+
+static void mix_pcm(stream_sample_t *buffer, const INT16 *pcm, int volume, int samples)
 {
+#ifdef __SSE2__
+	// pmaddwd against (volume, 0) pairs sign-extends and multiplies in one step
+	const __m128i vvolume = _mm_set1_epi32(volume & 0xffff);
+	for ( ; samples >= 4; samples -= 4, pcm += 4, buffer += 4)
+	{
+		__m128i product = _mm_madd_epi16(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)pcm), _mm_setzero_si128()), vvolume);
+
+		// divide by 2, rounding towards zero like the scalar code
+		product = _mm_srai_epi32(_mm_add_epi32(product, _mm_srli_epi32(product, 31)), 1);
+		_mm_storeu_si128((__m128i *)buffer, _mm_add_epi32(_mm_loadu_si128((const __m128i *)buffer), product));
+	}
+#endif
+	while (samples-- > 0)
+		*buffer++ += *pcm++ * volume / 2;
 }
 
 
@@ -399,6 +534,30 @@ void okim6295_device::okim_voice::generate_adpcm(direct_read_data &direct, strea
 	if (!m_playing)
 		return;
 
+	// if the phrase is already decoded, just mix it
+	if (m_cache != NULL)
+	{
+		UINT32 count = MIN(UINT32(samples), m_count - m_sample);
+		if (count == 0)
+			return;
+
+		// drivers may copy new data over the phrase or switch a bank under it while it plays;
+		// decode from memory once the block's pages are remapped or its bytes differ
+		UINT32 first = m_sample / 2;
+		UINT32 bytes = (m_sample + count - 1) / 2 - first + 1;
+		const UINT8 *live = contiguous_bytes(direct, m_base_offset + first, m_base_offset + first + bytes - 1);
+		if (live == NULL || memcmp(live, &m_cache->m_raw[first], bytes) != 0)
+			leave_cache();
+		else
+		{
+			mix_pcm(buffer, &m_cache->m_pcm[m_sample], m_volume, count);
+			m_sample += count;
+			if (m_sample >= m_count)
+				m_playing = false;
+			return;
+		}
+	}
+
 	// loop while we still have samples to generate
 	while (samples-- != 0)
 	{
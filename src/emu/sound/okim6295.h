@@ -75,6 +75,7 @@ protected:
 	// device-level overrides
 	virtual void device_start();
 	virtual void device_reset();
+	virtual void device_pre_save();
 	virtual void device_post_load();
 	virtual void device_clock_changed();
 
@@ -84,12 +85,25 @@ protected:
 	// device_sound_interface overrides
 	virtual void sound_stream_update(sound_stream &stream, stream_sample_t **inputs, stream_sample_t **outputs, int samples);
 
+	// a sample phrase decoded once to PCM
+	class okim_cache_entry
+	{
+	public:
+		okim_cache_entry *next() const { return m_next; }
+
+		okim_cache_entry *      m_next;     // next entry in the list
+		offs_t                  m_start;    // start address of the phrase
+		dynamic_array<UINT8>    m_raw;      // ADPCM bytes the PCM was decoded from
+		dynamic_array<INT16>    m_pcm;      // decoded samples, before volume
+	};
+
 	// a single voice
 	class okim_voice
 	{
 	public:
 		okim_voice();
 		void generate_adpcm(direct_read_data &direct, stream_sample_t *buffer, int samples);
+		void leave_cache();
 
 		oki_adpcm_state m_adpcm;        // current ADPCM state
 		bool            m_playing;
@@ -97,8 +111,13 @@ protected:
 		UINT32          m_sample;       // current sample number
 		UINT32          m_count;        // total samples to play
 		INT8            m_volume;       // output volume
+		const okim_cache_entry *m_cache; // pre-decoded phrase being played, or NULL
 	};
 
+	// internal helpers
+	static const UINT8 *contiguous_bytes(direct_read_data &direct, offs_t start, offs_t stop);
+	const okim_cache_entry *cached_phrase(offs_t start, offs_t stop);
+
 	// configuration state
 	const address_space_config  m_space_config;
 
@@ -112,7 +131,11 @@ protected:
 	sound_stream *      m_stream;
 	UINT8               m_pin7_state;
 	direct_read_data *  m_direct;
+	bool                m_use_cache;        // play phrases from decoded copies
+	simple_list<okim_cache_entry> m_cache;  // phrases decoded so far
+	UINT32              m_cache_bytes;      // memory used by the cache
 
+	static const UINT32 CACHE_MAX_BYTES = 16 * 1024 * 1024;
 	static const UINT8 s_volume_table[16];
 };
 
@@ -1692,6 +1692,13 @@ INLINE void chan_calc(YM2151 *PSG, unsigned int chan)
 	PSG->m2 = PSG->c1 = PSG->c2 = PSG->mem = 0;
 	op = &PSG->oper[chan*4];    /* M1 */
 
+	/* a channel with every operator below audibility and no feedback or MEM
+	   history left produces nothing (phases are advanced separately) */
+	if (op[0].tl + (UINT32)op[0].volume >= ENV_QUIET && op[1].tl + (UINT32)op[1].volume >= ENV_QUIET &&
+		op[2].tl + (UINT32)op[2].volume >= ENV_QUIET && op[3].tl + (UINT32)op[3].volume >= ENV_QUIET &&
+		op->fb_out_prev == 0 && op->fb_out_curr == 0 && op->mem_value == 0)
+		return;
+
 	*op->mem_connect = op->mem_value;   /* restore delayed sample (MEM) value to m2 or c2 */
 
 	if (op->ams)
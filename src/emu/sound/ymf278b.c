@@ -776,6 +776,13 @@ static void ymf278b_C_w(YMF278BChip *chip, UINT8 reg, UINT8 data, int init)
 	chip->pcmregs[reg] = data;
 }
 
+// slot registers other than the wave number only change what the chip plays,
+// so they can wait in the stream's write queue
+static void ymf278b_deferred_C_w(device_t *device, offs_t offset, UINT8 data)
+{
+	ymf278b_C_w(get_safe_token(device), offset, data, 1);
+}
+
 static TIMER_CALLBACK( ymf278b_timer_busy_clear )
 {
 	YMF278BChip *chip = (YMF278BChip *)ptr;
@@ -816,7 +823,10 @@ WRITE8_DEVICE_HANDLER( ymf278b_w )
 
 		case 5:
 			ymf278b_timer_busy_start(chip, 1);
-			ymf278b_C_w(chip, chip->port_C, data, 0);
+			if (chip->port_C >= 0x20 && chip->port_C <= 0xf7 && (chip->exp & 2))
+				chip->stream->queue_write(ymf278b_deferred_C_w, chip->port_C, data);
+			else
+				ymf278b_C_w(chip, chip->port_C, data, 0);
 			break;
 
 		default:
@@ -857,6 +867,9 @@ READ8_DEVICE_HANDLER( ymf278b_r )
 			if (~chip->exp & 2)
 				break;
 
+			// apply any queued slot writes before reading them back
+			chip->stream->update();
+
 			switch (chip->port_C)
 			{
 				// special cases
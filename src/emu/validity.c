@@ -56,6 +56,15 @@ UINT8 your_ptr64_flag_is_wrong[(int)(5 - sizeof(void *))];
 
 
 
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// file in the cache directory listing the source files this build found clean
+static const char validity_cache_filename[] = "validity.cache";
+
+
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
@@ -205,6 +214,46 @@ void validity_checker::check_shared_source(const game_driver &driver)
 }
 
 
+//-------------------------------------------------
+//  check_shared_source_once - check all drivers
+//  that share the same source file as the given
+//  driver, unless this build has already found
+//  them clean
+//-------------------------------------------------
+
+void validity_checker::check_shared_source_once(const game_driver &driver)
+{
+	emu_options &options = m_drivlist.options();
+
+	// read the source files already found clean; the list is only good for
+	// the exact build that wrote it, so it is keyed on the link time stamp
+	astring checked;
+	{
+		emu_file file(options.cache_directory(), OPEN_FLAG_READ);
+		if (file.open(validity_cache_filename) == FILERR_NONE)
+		{
+			char line[1024];
+			if (file.gets(line, ARRAY_LENGTH(line)) != NULL && strcmp(line, astring(build_version, " ", build_stamp).cat("\n")) == 0)
+				while (file.gets(line, ARRAY_LENGTH(line)) != NULL)
+				{
+					if (strcmp(line, astring(driver.source_file).cat("\n")) == 0)
+						return;
+					checked.cat(line);
+				}
+		}
+	}
+
+	// run the checks, and remember the source file only if nothing came up
+	check_shared_source(driver);
+	if (m_errors != 0 || m_warnings != 0)
+		return;
+
+	emu_file file(options.cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(validity_cache_filename) == FILERR_NONE)
+		file.printf("%s %s\n%s%s\n", build_version, build_stamp, checked.cstr(), driver.source_file);
+}
+
+
 //-------------------------------------------------
 //  check_all - check all drivers
 //-------------------------------------------------
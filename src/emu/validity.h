@@ -71,6 +71,7 @@ public:
 	// operations
 	void check_driver(const game_driver &driver);
 	void check_shared_source(const game_driver &driver);
+	void check_shared_source_once(const game_driver &driver);
 	void check_all();
 
 	// helpers for devices
@@ -133,10 +133,22 @@ video_manager::video_manager(running_machine &machine)
 		m_avifile(NULL),
 		m_movie_frame_period(attotime::zero),
 		m_movie_next_frame_time(attotime::zero),
-		m_movie_frame(0)
+		m_movie_frame(0),
+		m_movie_queue(NULL),
+		m_movie_queue_index(0),
+		m_movie_error(0),
+		m_movie_stalls(0)
 {
 	// request a callback upon exiting
 	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(video_manager::exit), this));
+
+	// the movie frames start out empty and owned by us
+	for (int index = 0; index < MOVIE_QUEUE_FRAMES; index++)
+	{
+		m_movie_queue_frame[index].manager = this;
+		m_movie_queue_frame[index].item = NULL;
+		m_movie_queue_frame[index].count = 0;
+	}
 	machine.save().register_postload(save_prepost_delegate(FUNC(video_manager::postload), this));
 
 	// extract initial execution state from global configuration settings
@@ -400,6 +412,13 @@ void video_manager::begin_recording(const char *name, movie_format format)
 	// reset the state
 	m_movie_frame = 0;
 	m_movie_next_frame_time = machine().time();
+	m_movie_queue_index = 0;
+	m_movie_error = 0;
+	m_movie_stalls = 0;
+
+	// frames are encoded on their own thread; if the queue can't be made, they are encoded inline
+	if (m_movie_queue == NULL)
+		m_movie_queue = osd_work_queue_alloc(0);
 
 	// start up an AVI recording
 	if (format == MF_AVI)
@@ -487,6 +506,12 @@ void video_manager::begin_recording(const char *name, movie_format format)
 
 void video_manager::end_recording()
 {
+	// let the encoder finish everything queued so far
+	movie_flush();
+	if (m_movie_stalls > 0)
+		mame_printf_warning("Movie encoder could not keep up; emulation waited on it %d times\n", m_movie_stalls);
+	m_movie_stalls = 0;
+
 	// close the file if it exists
 	if (m_avifile != NULL)
 	{
@@ -517,14 +542,18 @@ void video_manager::add_sound_to_recording(const INT16 *sound, int numsamples)
 	// only record if we have a file
 	if (m_avifile != NULL)
 	{
+		// stop if the encoder hit an error
+		if (m_movie_error)
+			return end_recording();
+
 		g_profiler.start(PROFILER_MOVIE_REC);
 
-		// write the next frame
-		avi_error avierr = avi_append_sound_samples(m_avifile, 0, sound + 0, numsamples, 1);
-		if (avierr == AVIERR_NONE)
-			avierr = avi_append_sound_samples(m_avifile, 1, sound + 1, numsamples, 1);
-		if (avierr != AVIERR_NONE)
-			end_recording();
+		// queue the samples ahead of the next video frame so the streams stay in order
+		movie_frame &frame = movie_fill_frame();
+		int base = frame.sound.count();
+		frame.sound.resize(base + numsamples * 2, true);
+		if (numsamples > 0)
+			memcpy(&frame.sound[base], sound, numsamples * 2 * sizeof(INT16));
 
 		g_profiler.stop();
 	}
@@ -540,6 +569,9 @@ void video_manager::exit()
 {
 	// stop recording any movie
 	end_recording();
+	if (m_movie_queue != NULL)
+		osd_work_queue_free(m_movie_queue);
+	m_movie_queue = NULL;
 
 	// free all the graphics elements
 	for (int i = 0; i < MAX_GFX_ELEMENTS; i++)
@@ -1228,57 +1260,187 @@ void video_manager::record_frame()
 	if (m_mngfile == NULL && m_avifile == NULL)
 		return;
 
+	// stop if the encoder hit an error
+	if (m_movie_error)
+		return end_recording();
+
 	// start the profiler and get the current time
 	g_profiler.start(PROFILER_MOVIE_REC);
 	attotime curtime = machine().time();
 
-	// create the bitmap
-	create_snapshot_bitmap(NULL);
-
-	// loop until we hit the right time
+	// count how many movie frames are due
+	UINT32 count = 0;
 	while (m_movie_next_frame_time <= curtime)
+	{
+		m_movie_next_frame_time += m_movie_frame_period;
+		count++;
+	}
+
+	if (count > 0)
+	{
+		// create the bitmap
+		create_snapshot_bitmap(NULL);
+
+		// copy it into the next free frame and hand it to the encoder
+		movie_frame &frame = movie_fill_frame();
+		if (frame.bitmap.width() != m_snap_bitmap.width() || frame.bitmap.height() != m_snap_bitmap.height())
+			frame.bitmap.allocate(m_snap_bitmap.width(), m_snap_bitmap.height());
+		copybitmap(frame.bitmap, m_snap_bitmap, 0, 0, 0, 0, m_snap_bitmap.cliprect());
+		frame.count = count;
+		frame.number = m_movie_frame;
+		frame.palette = (machine().palette != NULL) ? palette_entry_list_adjusted(machine().palette) : NULL;
+		frame.numcolors = machine().total_colors();
+		movie_submit_frame();
+
+		m_movie_frame += count;
+	}
+	g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  movie_fill_frame - return the movie frame
+//  being filled, waiting for the encoder to
+//  release it if necessary
+//-------------------------------------------------
+
+video_manager::movie_frame &video_manager::movie_fill_frame()
+{
+	movie_frame &frame = m_movie_queue_frame[m_movie_queue_index];
+
+	// if the encoder still has it, the queue is full and we have to wait
+	if (frame.item != NULL)
+	{
+		if (!osd_work_item_wait(frame.item, 0))
+		{
+			m_movie_stalls++;
+			while (!osd_work_item_wait(frame.item, osd_ticks_per_second())) ;
+		}
+		osd_work_item_release(frame.item);
+		frame.item = NULL;
+		frame.count = 0;
+		frame.sound.resize(0);
+	}
+	return frame;
+}
+
+
+//-------------------------------------------------
+//  movie_submit_frame - queue the frame being
+//  filled to the encoder and move on to the next
+//-------------------------------------------------
+
+void video_manager::movie_submit_frame()
+{
+	movie_frame &frame = m_movie_queue_frame[m_movie_queue_index];
+	if (frame.item != NULL || (frame.count == 0 && frame.sound.count() == 0))
+		return;
+
+	// work items on a single-threaded queue run in the order they were queued
+	if (m_movie_queue != NULL)
+		frame.item = osd_work_item_queue(m_movie_queue, movie_encode_callback, &frame, 0);
+	if (frame.item == NULL)
+	{
+		movie_encode_callback(&frame, 0);
+		frame.count = 0;
+		frame.sound.resize(0);
+	}
+	m_movie_queue_index = (m_movie_queue_index + 1) % MOVIE_QUEUE_FRAMES;
+}
+
+
+//-------------------------------------------------
+//  movie_flush - write out any pending sound and
+//  wait for the encoder to drain
+//-------------------------------------------------
+
+void video_manager::movie_flush()
+{
+	movie_submit_frame();
+	for (int index = 0; index < MOVIE_QUEUE_FRAMES; index++)
+	{
+		movie_frame &frame = m_movie_queue_frame[index];
+		if (frame.item != NULL)
+		{
+			while (!osd_work_item_wait(frame.item, osd_ticks_per_second())) ;
+			osd_work_item_release(frame.item);
+			frame.item = NULL;
+		}
+		frame.count = 0;
+		frame.sound.resize(0);
+	}
+	m_movie_queue_index = 0;
+}
+
+
+//-------------------------------------------------
+//  movie_encode_callback - write a queued frame
+//  and the sound preceding it to the movie;
+//  runs on the encoder thread
+//-------------------------------------------------
+
+void *video_manager::movie_encode_callback(void *param, int threadid)
+{
+	movie_frame &frame = *(movie_frame *)param;
+	video_manager &video = *frame.manager;
+
+	// once something failed, drop everything until the recording is stopped
+	if (video.m_movie_error)
+		return NULL;
+
+	// write the sound first, as it arrived before this frame
+	if (video.m_avifile != NULL && frame.sound.count() > 0)
+	{
+		int numsamples = frame.sound.count() / 2;
+		avi_error avierr = avi_append_sound_samples(video.m_avifile, 0, &frame.sound[0], numsamples, 1);
+		if (avierr == AVIERR_NONE)
+			avierr = avi_append_sound_samples(video.m_avifile, 1, &frame.sound[1], numsamples, 1);
+		if (avierr != AVIERR_NONE)
+		{
+			atomic_exchange32(&video.m_movie_error, 1);
+			return NULL;
+		}
+	}
+
+	// write the frame as many times as movie frames elapsed
+	for (UINT32 index = 0; index < frame.count; index++)
 	{
 		// handle an AVI recording
-		if (m_avifile != NULL)
+		if (video.m_avifile != NULL)
 		{
 			// write the next frame
-			avi_error avierr = avi_append_video_frame(m_avifile, m_snap_bitmap);
+			avi_error avierr = avi_append_video_frame(video.m_avifile, frame.bitmap);
 			if (avierr != AVIERR_NONE)
 			{
-				g_profiler.stop();
-				return end_recording();
+				atomic_exchange32(&video.m_movie_error, 1);
+				return NULL;
 			}
 		}
 
 		// handle a MNG recording
-		if (m_mngfile != NULL)
+		if (video.m_mngfile != NULL)
 		{
 			// set up the text fields in the movie info
 			png_info pnginfo = { 0 };
-			if (m_movie_frame == 0)
+			if (frame.number + index == 0)
 			{
 				astring text1(emulator_info::get_appname(), " ", build_version);
-				astring text2(machine().system().manufacturer, " ", machine().system().description);
+				astring text2(video.machine().system().manufacturer, " ", video.machine().system().description);
 				png_add_text(&pnginfo, "Software", text1);
 				png_add_text(&pnginfo, "System", text2);
 			}
 
 			// write the next frame
-			const rgb_t *palette = (machine().palette != NULL) ? palette_entry_list_adjusted(machine().palette) : NULL;
-			png_error error = mng_capture_frame(*m_mngfile, &pnginfo, m_snap_bitmap, machine().total_colors(), palette);
+			png_error error = mng_capture_frame(*video.m_mngfile, &pnginfo, frame.bitmap, frame.numcolors, frame.palette);
 			png_free(&pnginfo);
 			if (error != PNGERR_NONE)
 			{
-				g_profiler.stop();
-				return end_recording();
+				atomic_exchange32(&video.m_movie_error, 1);
+				return NULL;
 			}
 		}
-
-		// advance time
-		m_movie_next_frame_time += m_movie_frame_period;
-		m_movie_frame++;
 	}
-	g_profiler.stop();
+	return NULL;
 }
 
 
@@ -118,6 +118,20 @@ public:
 	void add_sound_to_recording(const INT16 *sound, int numsamples);
 
 private:
+	// a frame handed to the movie encoder thread
+	static const int MOVIE_QUEUE_FRAMES = 8;
+	struct movie_frame
+	{
+		video_manager *     manager;                // owning manager
+		osd_work_item *     item;                   // work item while queued, or NULL
+		bitmap_rgb32        bitmap;                 // copy of the snapshot bitmap
+		UINT32              count;                  // number of movie frames to write (0 = sound only)
+		UINT32              number;                 // movie frame number of the first frame
+		const rgb_t *       palette;                // palette at the time of capture
+		int                 numcolors;              // number of palette entries
+		dynamic_array<INT16> sound;                 // interleaved stereo samples preceding the frame
+	};
+
 	// internal helpers
 	void exit();
 	void screenless_update_callback(void *ptr, int param);
@@ -141,6 +155,10 @@ private:
 	void create_snapshot_bitmap(screen_device *screen);
 	file_error open_next(emu_file &file, const char *extension);
 	void record_frame();
+	movie_frame &movie_fill_frame();
+	void movie_submit_frame();
+	void movie_flush();
+	static void *movie_encode_callback(void *param, int threadid);
 
 	// internal state
 	running_machine &   m_machine;                  // reference to our machine
@@ -195,6 +213,13 @@ private:
 	attotime            m_movie_next_frame_time;    // time of next frame
 	UINT32              m_movie_frame;              // current movie frame number
 
+	// movie encoding, done on a separate thread
+	osd_work_queue *    m_movie_queue;              // queue feeding the encoder thread
+	movie_frame         m_movie_queue_frame[MOVIE_QUEUE_FRAMES]; // ring of frames in flight
+	int                 m_movie_queue_index;        // frame currently being filled
+	volatile INT32      m_movie_error;              // set by the encoder when a write fails
+	UINT32              m_movie_stalls;             // times emulation waited for the encoder
+
 	static const UINT8      s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS];
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
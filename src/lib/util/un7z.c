@@ -187,8 +187,24 @@ void FileOutStream_CreateVTable(CFileOutStream *p)
     CONSTANTS
 ***************************************************************************/
 
-/* number of open files to cache */
-#define _7Z_CACHE_SIZE  8
+/* maximum number of closed files to cache, and the memory they may use */
+#define _7Z_CACHE_SIZE      64
+#define _7Z_CACHE_MEMORY    (256 * 1024 * 1024)
+
+/* number of hash buckets used to remember files that don't exist */
+#define _7Z_MISSING_HASH_SIZE   389
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* a _7Z filename that failed to open because it doesn't exist */
+struct _7z_missing_file
+{
+	_7z_missing_file *  next;                   /* next file in this hash bucket */
+	char                filename[1];            /* name of the file */
+};
 
 
 /***************************************************************************
@@ -196,6 +212,7 @@ void FileOutStream_CreateVTable(CFileOutStream *p)
 ***************************************************************************/
 
 static _7z_file *_7z_cache[_7Z_CACHE_SIZE];
+static _7z_missing_file *_7z_missing[_7Z_MISSING_HASH_SIZE];
 
 /***************************************************************************
     FUNCTION PROTOTYPES
@@ -203,6 +220,9 @@ static _7z_file *_7z_cache[_7Z_CACHE_SIZE];
 
 /* cache management */
 static void free__7z_file(_7z_file *_7z);
+static UINT64 _7z_file_memory(const _7z_file *_7z);
+static _7z_missing_file **find_missing_file(const char *filename);
+static void add_missing_file(const char *filename);
 
 
 /***************************************************************************
@@ -333,6 +353,10 @@ _7z_error _7z_file_open(const char *filename, _7z_file **_7z)
 		}
 	}
 
+	/* don't go back to the disk for files we already know aren't there */
+	if (*find_missing_file(filename) != NULL)
+		return _7ZERR_FILE_ERROR;
+
 	/* allocate memory for the _7z_file structure */
 	new_7z = (_7z_file *)malloc(sizeof(*new_7z));
 	if (new_7z == NULL)
@@ -344,6 +368,8 @@ _7z_error _7z_file_open(const char *filename, _7z_file **_7z)
 	err = osd_open(filename, OPEN_FLAG_READ, &new_7z->archiveStream.file._7z_osdfile, &new_7z->archiveStream.file._7z_length);
 	if (err != FILERR_NONE)
 	{
+		if (err == FILERR_NOT_FOUND)
+			add_missing_file(filename);
 		_7zerr = _7ZERR_FILE_ERROR;
 		goto error;
 	}
@@ -407,6 +433,7 @@ error:
 
 void _7z_file_close(_7z_file *_7z)
 {
+	UINT64 memory;
 	int cachenum;
 
 	/* close the open files */
@@ -427,17 +454,32 @@ void _7z_file_close(_7z_file *_7z)
 	if (cachenum != 0)
 		memmove(&_7z_cache[1], &_7z_cache[0], cachenum * sizeof(_7z_cache[0]));
 	_7z_cache[0] = _7z;
+
+	/* then free the least recently used entries that don't fit in memory */
+	memory = 0;
+	for (cachenum = 0; cachenum < ARRAY_LENGTH(_7z_cache); cachenum++)
+		if (_7z_cache[cachenum] != NULL)
+		{
+			memory += _7z_file_memory(_7z_cache[cachenum]);
+			if (cachenum != 0 && memory > _7Z_CACHE_MEMORY)
+			{
+				free__7z_file(_7z_cache[cachenum]);
+				_7z_cache[cachenum] = NULL;
+			}
+		}
 }
 
 
 /*-------------------------------------------------
     _7z_file_cache_clear - clear the _7Z file
-    cache and free all memory
+    cache and free all memory; this also forgets
+    which files were missing
 -------------------------------------------------*/
 
 void _7z_file_cache_clear(void)
 {
 	int cachenum;
+	int hashnum;
 
 	/* clear call cache entries */
 	for (cachenum = 0; cachenum < ARRAY_LENGTH(_7z_cache); cachenum++)
@@ -446,6 +488,15 @@ void _7z_file_cache_clear(void)
 			free__7z_file(_7z_cache[cachenum]);
 			_7z_cache[cachenum] = NULL;
 		}
+
+	/* clear the missing files */
+	for (hashnum = 0; hashnum < ARRAY_LENGTH(_7z_missing); hashnum++)
+		while (_7z_missing[hashnum] != NULL)
+		{
+			_7z_missing_file *missing = _7z_missing[hashnum];
+			_7z_missing[hashnum] = missing->next;
+			free(missing);
+		}
 }
 
 
@@ -469,6 +520,36 @@ _7z_error _7z_file_decompress(_7z_file *new_7z, void *buffer, UINT32 length)
 			return _7ZERR_FILE_ERROR;
 	}
 
+	/* empty files don't live in a block; don't let the extractor free the current one */
+	UInt32 blockIndex = new_7z->db.FileIndexToFolderIndexMap[index];
+	if (blockIndex == (UInt32)-1)
+		return _7ZERR_NONE;
+
+	/* if this file is in a different solid block, look for it among the ones we kept */
+	if (new_7z->outBuffer != NULL && new_7z->blockIndex != blockIndex)
+	{
+		_7z_block current = { new_7z->blockIndex, new_7z->outBuffer, new_7z->outBufferSize };
+		int blocknum;
+
+		for (blocknum = 0; blocknum < ARRAY_LENGTH(new_7z->oldBlocks) - 1; blocknum++)
+			if (new_7z->oldBlocks[blocknum].outBuffer != NULL && new_7z->oldBlocks[blocknum].blockIndex == blockIndex)
+				break;
+
+		/* if it isn't there, the least recently used block makes room */
+		if (new_7z->oldBlocks[blocknum].outBuffer != NULL && new_7z->oldBlocks[blocknum].blockIndex != blockIndex)
+		{
+			IAlloc_Free(&new_7z->allocImp, new_7z->oldBlocks[blocknum].outBuffer);
+			new_7z->oldBlocks[blocknum].outBuffer = NULL;
+		}
+
+		/* make it current, and keep the previous current block at the top of the list */
+		new_7z->blockIndex = new_7z->oldBlocks[blocknum].blockIndex;
+		new_7z->outBuffer = new_7z->oldBlocks[blocknum].outBuffer;
+		new_7z->outBufferSize = new_7z->oldBlocks[blocknum].outBufferSize;
+		memmove(&new_7z->oldBlocks[1], &new_7z->oldBlocks[0], blocknum * sizeof(new_7z->oldBlocks[0]));
+		new_7z->oldBlocks[0] = current;
+	}
+
 	size_t offset = 0;
 	size_t outSizeProcessed = 0;
 
@@ -507,9 +588,68 @@ static void free__7z_file(_7z_file *_7z)
 
 
 		if (_7z->outBuffer) IAlloc_Free(&_7z->allocImp, _7z->outBuffer);
+		for (int blocknum = 0; blocknum < ARRAY_LENGTH(_7z->oldBlocks); blocknum++)
+			if (_7z->oldBlocks[blocknum].outBuffer) IAlloc_Free(&_7z->allocImp, _7z->oldBlocks[blocknum].outBuffer);
 		if (_7z->inited) SzArEx_Free(&_7z->db, &_7z->allocImp);
 
 
 		free(_7z);
 	}
 }
+
+
+/*-------------------------------------------------
+    _7z_file_memory - return the amount of memory
+    a cached _7z_file holds on to
+-------------------------------------------------*/
+
+static UINT64 _7z_file_memory(const _7z_file *_7z)
+{
+	UINT64 memory = sizeof(*_7z) + _7z->outBufferSize;
+	for (int blocknum = 0; blocknum < ARRAY_LENGTH(_7z->oldBlocks); blocknum++)
+		if (_7z->oldBlocks[blocknum].outBuffer != NULL)
+			memory += _7z->oldBlocks[blocknum].outBufferSize;
+	return memory;
+}
+
+
+/*-------------------------------------------------
+    find_missing_file - find the hash chain link
+    that points to a missing filename, or the
+    NULL at the end of its chain
+-------------------------------------------------*/
+
+static _7z_missing_file **find_missing_file(const char *filename)
+{
+	UINT32 hash = 0;
+	const char *scan;
+	_7z_missing_file **missing;
+
+	for (scan = filename; *scan != 0; scan++)
+		hash = (hash * 33) ^ (UINT8)*scan;
+
+	for (missing = &_7z_missing[hash % ARRAY_LENGTH(_7z_missing)]; *missing != NULL; missing = &(*missing)->next)
+		if (strcmp((*missing)->filename, filename) == 0)
+			break;
+	return missing;
+}
+
+
+/*-------------------------------------------------
+    add_missing_file - remember that a filename
+    doesn't exist
+-------------------------------------------------*/
+
+static void add_missing_file(const char *filename)
+{
+	_7z_missing_file **missing = find_missing_file(filename);
+
+	/* if we're already there or out of memory, just forget it */
+	if (*missing != NULL)
+		return;
+	*missing = (_7z_missing_file *)malloc(sizeof(**missing) + strlen(filename));
+	if (*missing == NULL)
+		return;
+	(*missing)->next = NULL;
+	strcpy((*missing)->filename, filename);
+}
@@ -112,12 +112,24 @@ enum _7z_error
 	_7ZERR_BUFFER_TOO_SMALL
 };
 
+/* number of solid blocks besides the current one each file keeps decompressed */
+#define _7Z_CACHED_BLOCKS   7
+
 
 
 /***************************************************************************
     TYPE DEFINITIONS
 ***************************************************************************/
 
+/* a solid block that was decompressed earlier */
+struct _7z_block
+{
+	UInt32          blockIndex;             /* index of the block */
+	Byte *          outBuffer;              /* decompressed data, or NULL if unused */
+	size_t          outBufferSize;          /* size of the decompressed data */
+};
+
+
 /* describes an open _7Z file */
 struct  _7z_file
 {
@@ -139,6 +151,7 @@ struct  _7z_file
 	UInt32 blockIndex;// = 0xFFFFFFFF; /* it can have any value before first call (if outBuffer = 0) */
 	Byte *outBuffer;// = 0; /* it must be 0 before first call for each new archive. */
 	size_t outBufferSize;// = 0;  /* it can have any value before first call (if outBuffer = 0) */
+	_7z_block oldBlocks[_7Z_CACHED_BLOCKS]; /* earlier solid blocks, most recently used first */
 };
 
 
@@ -50,8 +50,12 @@
     CONSTANTS
 ***************************************************************************/
 
-/* number of open files to cache */
-#define ZIP_CACHE_SIZE  8
+/* maximum number of closed files to cache, and the memory they may use */
+#define ZIP_CACHE_SIZE      256
+#define ZIP_CACHE_MEMORY    (8 * 1024 * 1024)
+
+/* number of hash buckets used to remember files that don't exist */
+#define ZIP_MISSING_HASH_SIZE   389
 
 /* offsets in end of central directory structure */
 #define ZIPESIG         0x00
@@ -118,11 +122,25 @@ INLINE UINT32 read_dword(UINT8 *buf)
 
 
 
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* a ZIP filename that failed to open because it doesn't exist */
+struct zip_missing_file
+{
+	zip_missing_file *  next;                   /* next file in this hash bucket */
+	char                filename[1];            /* name of the file */
+};
+
+
+
 /***************************************************************************
     GLOBAL VARIABLES
 ***************************************************************************/
 
 static zip_file *zip_cache[ZIP_CACHE_SIZE];
+static zip_missing_file *zip_missing[ZIP_MISSING_HASH_SIZE];
 
 
 
@@ -132,6 +150,9 @@ static zip_file *zip_cache[ZIP_CACHE_SIZE];
 
 /* cache management */
 static void free_zip_file(zip_file *zip);
+static UINT32 zip_file_memory(const zip_file *zip);
+static zip_missing_file **find_missing_file(const char *filename);
+static void add_missing_file(const char *filename);
 
 /* ZIP file parsing */
 static zip_error read_ecd(zip_file *zip);
@@ -177,6 +198,10 @@ zip_error zip_file_open(const char *filename, zip_file **zip)
 		}
 	}
 
+	/* don't go back to the disk for files we already know aren't there */
+	if (*find_missing_file(filename) != NULL)
+		return ZIPERR_FILE_ERROR;
+
 	/* allocate memory for the zip_file structure */
 	newzip = (zip_file *)malloc(sizeof(*newzip));
 	if (newzip == NULL)
@@ -187,6 +212,8 @@ zip_error zip_file_open(const char *filename, zip_file **zip)
 	filerr = osd_open(filename, OPEN_FLAG_READ, &newzip->file, &newzip->length);
 	if (filerr != FILERR_NONE)
 	{
+		if (filerr == FILERR_NOT_FOUND)
+			add_missing_file(filename);
 		ziperr = ZIPERR_FILE_ERROR;
 		goto error;
 	}
@@ -244,6 +271,7 @@ error:
 
 void zip_file_close(zip_file *zip)
 {
+	UINT32 memory;
 	int cachenum;
 
 	/* close the open files */
@@ -264,17 +292,32 @@ void zip_file_close(zip_file *zip)
 	if (cachenum != 0)
 		memmove(&zip_cache[1], &zip_cache[0], cachenum * sizeof(zip_cache[0]));
 	zip_cache[0] = zip;
+
+	/* then free the least recently used entries that don't fit in memory */
+	memory = 0;
+	for (cachenum = 0; cachenum < ARRAY_LENGTH(zip_cache); cachenum++)
+		if (zip_cache[cachenum] != NULL)
+		{
+			memory += zip_file_memory(zip_cache[cachenum]);
+			if (cachenum != 0 && memory > ZIP_CACHE_MEMORY)
+			{
+				free_zip_file(zip_cache[cachenum]);
+				zip_cache[cachenum] = NULL;
+			}
+		}
 }
 
 
 /*-------------------------------------------------
     zip_file_cache_clear - clear the ZIP file
-    cache and free all memory
+    cache and free all memory; this also forgets
+    which files were missing
 -------------------------------------------------*/
 
 void zip_file_cache_clear(void)
 {
 	int cachenum;
+	int hashnum;
 
 	/* clear call cache entries */
 	for (cachenum = 0; cachenum < ARRAY_LENGTH(zip_cache); cachenum++)
@@ -283,6 +326,15 @@ void zip_file_cache_clear(void)
 			free_zip_file(zip_cache[cachenum]);
 			zip_cache[cachenum] = NULL;
 		}
+
+	/* clear the missing files */
+	for (hashnum = 0; hashnum < ARRAY_LENGTH(zip_missing); hashnum++)
+		while (zip_missing[hashnum] != NULL)
+		{
+			zip_missing_file *missing = zip_missing[hashnum];
+			zip_missing[hashnum] = missing->next;
+			free(missing);
+		}
 }
 
 
@@ -430,6 +482,59 @@ static void free_zip_file(zip_file *zip)
 }
 
 
+/*-------------------------------------------------
+    zip_file_memory - return the amount of memory
+    a cached zip_file holds on to
+-------------------------------------------------*/
+
+static UINT32 zip_file_memory(const zip_file *zip)
+{
+	return sizeof(*zip) + zip->ecd.rawlength + zip->ecd.cd_size;
+}
+
+
+/*-------------------------------------------------
+    find_missing_file - find the hash chain link
+    that points to a missing filename, or the
+    NULL at the end of its chain
+-------------------------------------------------*/
+
+static zip_missing_file **find_missing_file(const char *filename)
+{
+	UINT32 hash = 0;
+	const char *scan;
+	zip_missing_file **missing;
+
+	for (scan = filename; *scan != 0; scan++)
+		hash = (hash * 33) ^ (UINT8)*scan;
+
+	for (missing = &zip_missing[hash % ARRAY_LENGTH(zip_missing)]; *missing != NULL; missing = &(*missing)->next)
+		if (strcmp((*missing)->filename, filename) == 0)
+			break;
+	return missing;
+}
+
+
+/*-------------------------------------------------
+    add_missing_file - remember that a filename
+    doesn't exist
+-------------------------------------------------*/
+
+static void add_missing_file(const char *filename)
+{
+	zip_missing_file **missing = find_missing_file(filename);
+
+	/* if we're already there or out of memory, just forget it */
+	if (*missing != NULL)
+		return;
+	*missing = (zip_missing_file *)malloc(sizeof(**missing) + strlen(filename));
+	if (*missing == NULL)
+		return;
+	(*missing)->next = NULL;
+	strcpy((*missing)->filename, filename);
+}
+
+
 
 /***************************************************************************
     ZIP FILE PARSING
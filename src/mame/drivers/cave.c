@@ -2576,44 +2576,34 @@ MACHINE_CONFIG_END
 
 ***************************************************************************/
 
-/* 4 bits -> 8 bits. Even and odd pixels are swapped */
-static void unpack_sprites(running_machine &machine)
+/* 4 bits per pixel, kept packed: the even pixel is already in the low nibble */
+static void setup_packed_sprites(running_machine &machine)
 {
-	const UINT32 len    =   machine.root_device().memregion("sprites")->bytes();
-	UINT8 *rgn          =   machine.root_device().memregion       ("sprites")->base();
-	UINT8 *src          =   rgn + len / 2 - 1;
-	UINT8 *dst          =   rgn + len - 1;
+	cave_state *state = machine.driver_data<cave_state>();
 
-	while(dst > src)
-	{
-		UINT8 data = *src--;
-		/* swap even and odd pixels */
-		*dst-- = data >> 4;     *dst-- = data & 0xF;
-	}
+	state->m_sprite_packed = 1;
 }
 
 
-/* 4 bits -> 8 bits. Even and odd pixels and even and odd words, are swapped */
-static void ddonpach_unpack_sprites(running_machine &machine)
+/* 4 bits per pixel, kept packed. Bytes are swapped in pairs and the even
+   pixel is in the high nibble: reorder in place so the blitters can share
+   the low nibble first layout */
+static void ddonpach_setup_packed_sprites(running_machine &machine)
 {
+	cave_state *state   =   machine.driver_data<cave_state>();
 	const UINT32 len    =   machine.root_device().memregion("sprites")->bytes();
 	UINT8 *rgn          =   machine.root_device().memregion       ("sprites")->base();
-	UINT8 *src          =   rgn + len / 2 - 1;
-	UINT8 *dst          =   rgn + len - 1;
 
-	while(dst > src)
+	for (UINT32 offs = 0; offs + 1 < len; offs += 2)
 	{
-		UINT8 data1 = *src--;
-		UINT8 data2 = *src--;
-		UINT8 data3 = *src--;
-		UINT8 data4 = *src--;
-
-		/* swap even and odd pixels, and even and odd words */
-		*dst-- = data2 & 0xF;       *dst-- = data2 >> 4;
-		*dst-- = data1 & 0xF;       *dst-- = data1 >> 4;
-		*dst-- = data4 & 0xF;       *dst-- = data4 >> 4;
-		*dst-- = data3 & 0xF;       *dst-- = data3 >> 4;
+		UINT8 data0 = rgn[offs + 0];
+		UINT8 data1 = rgn[offs + 1];
+
+		rgn[offs + 0] = (data1 << 4) | (data1 >> 4);
+		rgn[offs + 1] = (data0 << 4) | (data0 >> 4);
 	}
+
+	state->m_sprite_packed = 1;
 }
 
 
@@ -2687,7 +2677,7 @@ BP962A.U77  23C16000    GFX
 	ROM_LOAD( "bp962a.u9",  0x00000, 0x08000, CRC(06caddbe) SHA1(6a3cc50558ba19a31b21b7f3ec6c6e2846244ff1) ) \
 	ROM_CONTINUE(           0x10000, 0x78000             ) \
 	\
-	ROM_REGION( 0x400000 * 2, "sprites", 0 ) \
+	ROM_REGION( 0x400000, "sprites", 0 ) \
 	ROM_LOAD( "bp962a.u76", 0x000000, 0x200000, CRC(858da439) SHA1(33a3d2a3ec3fa3364b00e1e43b405e5030a5b2a3) ) \
 	ROM_LOAD( "bp962a.u77", 0x200000, 0x200000, CRC(ea2ba35e) SHA1(72487f21d44fe7be9a98068ce7f57a43c132945f) ) \
 	\
@@ -2767,7 +2757,7 @@ ROM_START( dfeveron )
 	ROM_LOAD16_BYTE( "cv01-u34.bin", 0x000000, 0x080000, CRC(be87f19d) SHA1(595239245df3835cdf5a99a6c62480465558d8d3) )
 	ROM_LOAD16_BYTE( "cv01-u33.bin", 0x000001, 0x080000, CRC(e53a7db3) SHA1(ddced29f78dc3cc89038757b6577ba2ba0d8b041) )
 
-	ROM_REGION( 0x800000 * 2, "sprites", 0 )        /* Sprites: * 2 */
+	ROM_REGION( 0x800000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "cv01-u25.bin", 0x000000, 0x400000, CRC(a6f6a95d) SHA1(e1eb45cb5d0e6163edfd9d830633b913fb53c6ca) )
 	ROM_LOAD( "cv01-u26.bin", 0x400000, 0x400000, CRC(32edb62a) SHA1(3def74e1316b80cc25a8c3ac162cd7bcb8cc807c) )
 
@@ -2873,7 +2863,7 @@ ROM_START( feversos )
 	ROM_LOAD16_BYTE( "cv01-u34.sos", 0x000000, 0x080000, CRC(24ef3ce6) SHA1(42799eebbb2686a837b8972aec684143deadca59) )
 	ROM_LOAD16_BYTE( "cv01-u33.sos", 0x000001, 0x080000, CRC(64ff73fd) SHA1(7fc3a8469cec2361d373a4dac4a547c13ca5f709) )
 
-	ROM_REGION( 0x800000 * 2, "sprites", 0 )        /* Sprites: * 2 */
+	ROM_REGION( 0x800000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "cv01-u25.bin", 0x000000, 0x400000, CRC(a6f6a95d) SHA1(e1eb45cb5d0e6163edfd9d830633b913fb53c6ca) )
 	ROM_LOAD( "cv01-u26.bin", 0x400000, 0x400000, CRC(32edb62a) SHA1(3def74e1316b80cc25a8c3ac162cd7bcb8cc807c) )
 
@@ -2908,7 +2898,7 @@ ROM_START( ddonpach )
 	ROM_LOAD16_BYTE( "b1.u27", 0x000000, 0x080000, CRC(b5cdc8d3) SHA1(58757b50e21a27e500a82c03f62cf02a85389926) )
 	ROM_LOAD16_BYTE( "b2.u26", 0x000001, 0x080000, CRC(6bbb063a) SHA1(e5de64b9c3efc0a38a2e0e16b78ee393bff63558) )
 
-	ROM_REGION( 0x800000 * 2, "sprites", 0 )        /* Sprites: * 2 */
+	ROM_REGION( 0x800000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "u50.bin", 0x000000, 0x200000, CRC(14b260ec) SHA1(33bda210302428d5500115d0c7a839cdfcb67d17) )
 	ROM_LOAD( "u51.bin", 0x200000, 0x200000, CRC(e7ba8cce) SHA1(ad74a6b7d53760b19587c4a6dbea937daa7e87ce) )
 	ROM_LOAD( "u52.bin", 0x400000, 0x200000, CRC(02492ee0) SHA1(64d9cc64a4ad189a8b03cf6a749ddb732b4a0014) )
@@ -2937,7 +2927,7 @@ ROM_START( ddonpachj )
 	ROM_LOAD16_BYTE( "u27.bin", 0x000000, 0x080000, CRC(2432ff9b) SHA1(fbc826c30553f6553ead40b312b73c049e8f4bf6) )
 	ROM_LOAD16_BYTE( "u26.bin", 0x000001, 0x080000, CRC(4f3a914a) SHA1(ae98eba049f1462aa1145f6959b9f9a32c97278f) )
 
-	ROM_REGION( 0x800000 * 2, "sprites", 0 )        /* Sprites: * 2 */
+	ROM_REGION( 0x800000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "u50.bin", 0x000000, 0x200000, CRC(14b260ec) SHA1(33bda210302428d5500115d0c7a839cdfcb67d17) )
 	ROM_LOAD( "u51.bin", 0x200000, 0x200000, CRC(e7ba8cce) SHA1(ad74a6b7d53760b19587c4a6dbea937daa7e87ce) )
 	ROM_LOAD( "u52.bin", 0x400000, 0x200000, CRC(02492ee0) SHA1(64d9cc64a4ad189a8b03cf6a749ddb732b4a0014) )
@@ -2966,7 +2956,7 @@ ROM_START( ddonpacha )
 	ROM_LOAD16_BYTE( "u27.bin", 0x000000, 0x080000, CRC(44b899ae) SHA1(798ec437d861b94fcd90c99a7015dd420887c788) )
 	ROM_LOAD16_BYTE( "u26.bin", 0x000001, 0x080000, CRC(727a09a8) SHA1(91876386855f19e8a3d8d1df71dfe9b3d98e9ea9) )
 
-	ROM_REGION( 0x800000 * 2, "sprites", 0 )		/* Sprites: * 2 */
+	ROM_REGION( 0x800000, "sprites", 0 )		/* Sprites */
 	ROM_LOAD( "u50.bin", 0x000000, 0x200000, CRC(14b260ec) SHA1(33bda210302428d5500115d0c7a839cdfcb67d17) )
 	ROM_LOAD( "u51.bin", 0x200000, 0x200000, CRC(0f3e5148) SHA1(3016f4d075940feae691389606cd2aa7ac53849e) )
 	ROM_LOAD( "u52.bin", 0x400000, 0x200000, CRC(02492ee0) SHA1(64d9cc64a4ad189a8b03cf6a749ddb732b4a0014) )
@@ -3033,7 +3023,7 @@ ROM_START( donpachi )
 	ROM_REGION( 0x080000, "maincpu", 0 )        /* 68000 code */
 	ROM_LOAD16_WORD_SWAP( "prgu.u29",     0x00000, 0x80000, CRC(89c36802) SHA1(7857c726cecca5a4fce282e0d2b873774d2c1b1d) )
 
-	ROM_REGION( 0x400000 * 2, "sprites", 0 )        /* Sprites */
+	ROM_REGION( 0x400000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "atdp.u44", 0x000000, 0x200000, CRC(7189e953) SHA1(53adbe6ea5e01ecb48575e9db82cc3d0dc8a3726) )
 	ROM_LOAD( "atdp.u45", 0x200000, 0x200000, CRC(6984173f) SHA1(625dd6674adeb206815855b8b6a1fba79ed5c4cd) )
 
@@ -3066,7 +3056,7 @@ ROM_START( donpachij )
 	ROM_REGION( 0x080000, "maincpu", 0 )        /* 68000 code */
 	ROM_LOAD16_WORD_SWAP( "prg.u29",     0x00000, 0x80000, CRC(6be14af6) SHA1(5b1158071f160efeded816ae4c4edca1d00d6e05) )
 
-	ROM_REGION( 0x400000 * 2, "sprites", 0 )        /* Sprites */
+	ROM_REGION( 0x400000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "atdp.u44", 0x000000, 0x200000, CRC(7189e953) SHA1(53adbe6ea5e01ecb48575e9db82cc3d0dc8a3726) )
 	ROM_LOAD( "atdp.u45", 0x200000, 0x200000, CRC(6984173f) SHA1(625dd6674adeb206815855b8b6a1fba79ed5c4cd) )
 
@@ -3099,7 +3089,7 @@ ROM_START( donpachikr )
 	ROM_REGION( 0x080000, "maincpu", 0 )        /* 68000 code */
 	ROM_LOAD16_WORD_SWAP( "prgk.u26",    0x00000, 0x80000, CRC(bbaf4c8b) SHA1(0f9d42c8c4c5b69e3d39bf768bc4b663f66b4f36) )
 
-	ROM_REGION( 0x400000 * 2, "sprites", 0 )        /* Sprites */
+	ROM_REGION( 0x400000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "atdp.u44", 0x000000, 0x200000, CRC(7189e953) SHA1(53adbe6ea5e01ecb48575e9db82cc3d0dc8a3726) )
 	ROM_LOAD( "atdp.u45", 0x200000, 0x200000, CRC(6984173f) SHA1(625dd6674adeb206815855b8b6a1fba79ed5c4cd) )
 
@@ -3132,7 +3122,7 @@ ROM_START( donpachihk )
 	ROM_REGION( 0x080000, "maincpu", 0 )        /* 68000 code */
 	ROM_LOAD16_WORD_SWAP( "37.u29",    0x00000, 0x80000, CRC(71f39f30) SHA1(08a028208f21c073d450a29061604f27775786a8) )
 
-	ROM_REGION( 0x400000 * 2, "sprites", 0 )        /* Sprites */
+	ROM_REGION( 0x400000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "atdp.u44", 0x000000, 0x200000, CRC(7189e953) SHA1(53adbe6ea5e01ecb48575e9db82cc3d0dc8a3726) )
 	ROM_LOAD( "atdp.u45", 0x200000, 0x200000, CRC(6984173f) SHA1(625dd6674adeb206815855b8b6a1fba79ed5c4cd) )
 
@@ -3304,7 +3294,7 @@ ROM_START( gaia )
 	ROM_LOAD16_BYTE( "prg1.127", 0x000000, 0x080000, CRC(47b904b2) SHA1(58b9b55f59cf00f70b690a0371096e86f4d723c2) )
 	ROM_LOAD16_BYTE( "prg2.128", 0x000001, 0x080000, CRC(469b7794) SHA1(502f855c51005a866900b19c3a0a170d9ea02392) )
 
-	ROM_REGION( 0x1000000, "sprites", 0 )  /* Sprites */
+	ROM_REGION( 0x800000, "sprites", 0 )   /* Sprites */
 	ROM_LOAD( "obj1.736", 0x000000, 0x400000, CRC(f4f84e5d) SHA1(8f445dd7a5c8a996939c211e5aec5742121a6e7e) )
 	ROM_LOAD( "obj2.738", 0x400000, 0x400000, CRC(15c2a9ce) SHA1(631eb2968395be86ef2403733e7d4ec769a013b9) )
 
@@ -3366,7 +3356,7 @@ ROM_START( theroes )
 	ROM_LOAD16_BYTE( "t-hero-epm1.u0127", 0x000000, 0x080000, CRC(09db7195) SHA1(6aa5aa80e3b74e405ed8f1b9b801ce4367756986) )
 	ROM_LOAD16_BYTE( "t-hero-epm0.u0129", 0x000001, 0x080000, CRC(2d4e3310) SHA1(7c3284a2adc7943db50933a209d037422f87f80b) )
 
-	ROM_REGION( 0x1000000, "sprites", 0 )  /* Sprites */
+	ROM_REGION( 0x800000, "sprites", 0 )   /* Sprites */
 	ROM_LOAD( "t-hero-obj1.u0736", 0x000000, 0x400000, CRC(35090f7c) SHA1(035e6c12a87d9c7241eea34fc7e2170bec842acc) )
 	ROM_LOAD( "t-hero-obj2.u0738", 0x400000, 0x400000, CRC(71605108) SHA1(6070c26d8f22fafc81d97cacfef96ae652e355d0) )
 
@@ -3531,7 +3521,7 @@ ROM_START( hotdogst )
 	ROM_LOAD( "mp2.u19", 0x00000, 0x08000, CRC(ff979ebe) SHA1(4cb80086cfdc69a321c7f75455cef89e20488b76) )   // FIRST AND SECOND HALF IDENTICAL
 	ROM_CONTINUE(        0x10000, 0x38000             )
 
-	ROM_REGION( 0x400000 * 2, "sprites", 0 )        /* Sprites: * 2 */
+	ROM_REGION( 0x400000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "mp9.u55", 0x000000, 0x200000, CRC(258d49ec) SHA1(f39e30c82d8f680f248e1eb59d7c5acb479fa277) )
 	ROM_LOAD( "mp8.u54", 0x200000, 0x200000, CRC(bdb4d7b8) SHA1(0dd490988aa84b0e9a21ade5fd606b03eca13f6c) )
 
@@ -3602,7 +3592,7 @@ ROM_START( korokoro )
 	ROM_REGION( 0x80000, "maincpu", 0 )     /* 68000 Code */
 	ROM_LOAD16_WORD_SWAP( "mp-001_ver07.u0130", 0x000000, 0x080000, CRC(86c7241f) SHA1(c9f0ab63c4fe36df1300445e9bb0d5c6a1bb733f) ) // 1xxxxxxxxxxxxxxxxxx = 0xFF
 
-	ROM_REGION( 0x180000 * 2, "sprites", 0 )        /* Sprites: * 2 */
+	ROM_REGION( 0x180000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "mp-001_ver01.u1066", 0x000000, 0x100000, CRC(c5c6af7e) SHA1(13ac26fd703672a01d629be4e5efe9fb8720a4fb) )
 	ROM_LOAD( "mp-001_ver01.u1051", 0x100000, 0x080000, CRC(fe5e28e8) SHA1(44da1a7d813b149f9bae351bbcbd0bc2d4c70e10) )  // 1xxxxxxxxxxxxxxxxxx = 0xFF
 
@@ -3617,7 +3607,7 @@ ROM_START( crusherm )
 	ROM_REGION( 0x80000, "maincpu", 0 )     /* 68000 Code */
 	ROM_LOAD16_WORD_SWAP( "mp-003ver01.u0130", 0x000000, 0x080000, CRC(a4f56e6b) SHA1(1d3af7602c48a6b6c76c376dbc8ad3823b56868a) )
 
-	ROM_REGION( 0x200000 * 2, "sprites", 0 )        /* Sprites: * 2 */
+	ROM_REGION( 0x200000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "mp-003ver01.u1067", 0x000000, 0x100000, CRC(268a4921) SHA1(8bb818466616051af01680b381af53b8b6a18428) )
 	ROM_LOAD( "mp-003ver01.u1066", 0x100000, 0x100000, CRC(79e77a6e) SHA1(9d03dd083769851d628ba6b3d77cfde9603e74f4) )
 
@@ -3667,7 +3657,7 @@ U55
 	ROM_LOAD( "mzs.u21", 0x00000, 0x08000, CRC(c5b4f7ed) SHA1(01f3cd1dd4045029260544e0e1c15dd08817012e) ) \
 	ROM_CONTINUE(        0x10000, 0x18000             ) \
 	\
-	ROM_REGION( 0x400000 * 2, "sprites", ROMREGION_ERASEFF ) \
+	ROM_REGION( 0x400000, "sprites", ROMREGION_ERASEFF ) \
 	ROM_LOAD( "bp943a-2.u56", 0x000000, 0x200000, CRC(97e13959) SHA1(c30b1093aacebafefcae701af767dd36fc55fac7) ) \
 	ROM_LOAD( "bp943a-3.u55", 0x200000, 0x080000, CRC(9c4957dd) SHA1(e775605a01b6cadc318855ac046dad03c4fc5bb4) ) \
 	\
@@ -3750,7 +3740,7 @@ ROM_START( metmqstr )
 	ROM_LOAD( "bp947a.u20",  0x00000, 0x08000, CRC(a4a36170) SHA1(ae55094518bd968ea0d04613a133c1421e412012) )
 	ROM_CONTINUE(            0x10000, 0x38000             )
 
-	ROM_REGION( 0x800000 * 2, "sprites", 0 )        /* Sprites */
+	ROM_REGION( 0x800000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "bp947a.u49", 0x000000, 0x200000, CRC(09749531) SHA1(6deeed2712241611ec3202c49a66beed28698af8) )
 	ROM_LOAD( "bp947a.u50", 0x200000, 0x200000, CRC(19cea8b2) SHA1(87fb29458074f0e4852237e0184b8b3b44b0eb29) )
 	ROM_LOAD( "bp947a.u51", 0x400000, 0x200000, CRC(c19bed67) SHA1(ac664a15512c0e8c8b701833aede95f53cd46a45) )
@@ -3787,7 +3777,7 @@ ROM_START( nmaster )
 	ROM_LOAD( "bp947a.u20",  0x00000, 0x08000, CRC(a4a36170) SHA1(ae55094518bd968ea0d04613a133c1421e412012) )
 	ROM_CONTINUE(            0x10000, 0x38000             )
 
-	ROM_REGION( 0x800000 * 2, "sprites", 0 )        /* Sprites */
+	ROM_REGION( 0x800000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "bp947a.u49", 0x000000, 0x200000, CRC(09749531) SHA1(6deeed2712241611ec3202c49a66beed28698af8) )
 	ROM_LOAD( "bp947a.u50", 0x200000, 0x200000, CRC(19cea8b2) SHA1(87fb29458074f0e4852237e0184b8b3b44b0eb29) )
 	ROM_LOAD( "bp947a.u51", 0x400000, 0x200000, CRC(c19bed67) SHA1(ac664a15512c0e8c8b701833aede95f53cd46a45) )
@@ -3838,7 +3828,7 @@ ROM_START( pacslot )
 	ROM_REGION( 0x080000, "maincpu", 0 )        /* 68000 code */
 	ROM_LOAD16_WORD_SWAP( "pa1-mprob.u41", 0x00000, 0x80000, CRC(56281370) SHA1(b75a7c5997adac14486cef7be4e41d113c86021f) )
 
-	ROM_REGION( 0x100000 * 2, "sprites", 0 )        /* Sprites */
+	ROM_REGION( 0x100000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD16_BYTE( "pa1-obj0.u52", 0x00000, 0x80000, CRC(bf9232ce) SHA1(9a887a964e9a75e16c59dcf217c664404e74cc2a) )
 	ROM_LOAD16_BYTE( "pa1-obj1.u53", 0x00001, 0x80000, CRC(6eb76a04) SHA1(66c8e36bee4439c203a02b30898e4f741205d681) )
 
@@ -3887,7 +3877,7 @@ ROM_START( pwrinst2 )
 	ROM_LOAD( "g02.u3a", 0x00000, 0x0c000, CRC(ebea5e1e) SHA1(4d3af9e5f29d0c1b26563f51250039c9e8bd3735) )
 	ROM_CONTINUE(        0x10000, 0x14000             )
 
-	ROM_REGION( 0xe00000 * 2, "sprites", 0 )        /* Sprites */
+	ROM_REGION( 0xe00000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "g02.u61", 0x000000, 0x200000, CRC(91e30398) SHA1(2b59a5e40bed2a988382054fe30d92808dad3348) )
 	ROM_LOAD( "g02.u62", 0x200000, 0x200000, CRC(d9455dd7) SHA1(afa69fe9a540cd78b8cfecf09cffa1401c01141a) )
 	ROM_LOAD( "g02.u63", 0x400000, 0x200000, CRC(4d20560b) SHA1(ceaee8cf0b69cc366b95ddcb689a5594d79e5114) )
@@ -3933,7 +3923,7 @@ ROM_START( pwrinst2j )
 	ROM_LOAD( "g02j.u3a", 0x00000, 0x0c000, CRC(eead01f1) SHA1(0ced6755e471e0303fe397b3d54a5c799762ebd8) )
 	ROM_CONTINUE(        0x10000, 0x14000             )
 
-	ROM_REGION( 0xe00000 * 2, "sprites", 0 )        /* Sprites */
+	ROM_REGION( 0xe00000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "g02.u61", 0x000000, 0x200000, CRC(91e30398) SHA1(2b59a5e40bed2a988382054fe30d92808dad3348) )
 	ROM_LOAD( "g02.u62", 0x200000, 0x200000, CRC(d9455dd7) SHA1(afa69fe9a540cd78b8cfecf09cffa1401c01141a) )
 	ROM_LOAD( "g02.u63", 0x400000, 0x200000, CRC(4d20560b) SHA1(ceaee8cf0b69cc366b95ddcb689a5594d79e5114) )
@@ -4033,7 +4023,7 @@ ROM_START( plegends )
 	ROM_LOAD( "d19.u3", 0x00000, 0x0c000, CRC(47598459) SHA1(4e9dcfebfbd160230768965e8c6e5ed446c1aa7b) ) /* Same as sound.u3 below, but twice the size? */
 	ROM_CONTINUE(        0x10000, 0x34000             )
 
-	ROM_REGION( 0x1000000 * 2, "sprites", 0 )       /* Sprites */
+	ROM_REGION( 0x1000000, "sprites", 0 )           /* Sprites */
 	ROM_LOAD( "g02.u61", 0x000000, 0x200000, CRC(91e30398) SHA1(2b59a5e40bed2a988382054fe30d92808dad3348) )
 	ROM_LOAD( "g02.u62", 0x200000, 0x200000, CRC(d9455dd7) SHA1(afa69fe9a540cd78b8cfecf09cffa1401c01141a) )
 	ROM_LOAD( "g02.u63", 0x400000, 0x200000, CRC(4d20560b) SHA1(ceaee8cf0b69cc366b95ddcb689a5594d79e5114) )
@@ -4081,7 +4071,7 @@ ROM_START( plegendsj )
 	ROM_LOAD( "sound.u3", 0x00000, 0x0c000, CRC(36f71520) SHA1(11d0a059ddba3e1aa4c54ccdde7b3f5c7bde482f) )
 	ROM_CONTINUE(        0x10000, 0x14000             )
 
-	ROM_REGION( 0x1000000 * 2, "sprites", 0 )       /* Sprites */
+	ROM_REGION( 0x1000000, "sprites", 0 )           /* Sprites */
 	ROM_LOAD( "g02.u61", 0x000000, 0x200000, CRC(91e30398) SHA1(2b59a5e40bed2a988382054fe30d92808dad3348) )
 	ROM_LOAD( "g02.u62", 0x200000, 0x200000, CRC(d9455dd7) SHA1(afa69fe9a540cd78b8cfecf09cffa1401c01141a) )
 	ROM_LOAD( "g02.u63", 0x400000, 0x200000, CRC(4d20560b) SHA1(ceaee8cf0b69cc366b95ddcb689a5594d79e5114) )
@@ -4174,7 +4164,7 @@ BPSM.U77    23C16000    GFX
 	ROM_LOAD( "bpsm945a.u9",  0x00000, 0x08000, CRC(438de548) SHA1(81a0ca1cd662e2017aa980da162d39cfd0a19f14) ) \
 	ROM_CONTINUE(             0x10000, 0x78000             ) \
 	\
-	ROM_REGION( 0x400000 * 2, "sprites", 0 ) \
+	ROM_REGION( 0x400000, "sprites", 0 ) \
 	ROM_LOAD( "bpsm.u76", 0x000000, 0x200000, CRC(a243a5ba) SHA1(3a32d685e53e0b75977f7acb187cf414a50c7f8b) ) \
 	ROM_LOAD( "bpsm.u77", 0x200000, 0x200000, CRC(5179a4ac) SHA1(ceb8d3d889aae885debb2c9cf2263f60be3f1212) ) \
 	\
@@ -4258,7 +4248,7 @@ ROM_END
 	ROM_LOAD( "bpsm945a.u9",  0x00000, 0x08000, CRC(438de548) SHA1(81a0ca1cd662e2017aa980da162d39cfd0a19f14) ) \
 	ROM_CONTINUE(             0x10000, 0x78000             ) \
 	\
-	ROM_REGION( 0x400000 * 2, "sprites", 0 ) \
+	ROM_REGION( 0x400000, "sprites", 0 ) \
 	ROM_LOAD( "bpsm.u76", 0x000000, 0x200000, CRC(a243a5ba) SHA1(3a32d685e53e0b75977f7acb187cf414a50c7f8b) ) \
 	ROM_LOAD( "bpsm.u77", 0x200000, 0x200000, CRC(5179a4ac) SHA1(ceb8d3d889aae885debb2c9cf2263f60be3f1212) ) \
 	\
@@ -4356,7 +4346,7 @@ ROM_START( tjumpman )
 	ROM_REGION( 0x080000, "maincpu", 0 )        /* 68000 code */
 	ROM_LOAD16_WORD_SWAP( "tj1_mpr-0c.u41", 0x00000, 0x80000, CRC(de3030b8) SHA1(5f2165ea039c34cab605ebddc0b61eadc47b1532) )
 
-	ROM_REGION( 0x100000 * 2, "sprites", 0 )        /* Sprites */
+	ROM_REGION( 0x100000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD16_BYTE( "tj1_obj-0a.u52", 0x00000, 0x80000, CRC(b42cf8e8) SHA1(9ed7fb3574ed163a81f34a0d8cfa7a4661439932) )
 	ROM_LOAD16_BYTE( "tj1_obj-1a.u53", 0x00001, 0x80000, CRC(5f0124d7) SHA1(4d9cfa464159998c176a178c668273d128dedff8) )
 
@@ -4386,7 +4376,7 @@ ROM_START( uopoko )
 	ROM_LOAD16_BYTE( "u26.int", 0x000000, 0x080000, CRC(b445c9ac) SHA1(4dda1c6e19de629ea4d9061560c32a9f0deabd53) )
 	ROM_LOAD16_BYTE( "u25.int", 0x000001, 0x080000, CRC(a1258482) SHA1(7f4adc4a6d069032aaf3d93eb60fde16b59483f8) )
 
-	ROM_REGION( 0x400000 * 2, "sprites", 0 )        /* Sprites: * 2 */
+	ROM_REGION( 0x400000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "u33.bin", 0x000000, 0x400000, CRC(5d142ad2) SHA1(f26abcf7a625a322b83df44fbd6e852bfb03663c) )
 
 	ROM_REGION( 0x400000, "layer0", 0 ) /* Layer 0 */
@@ -4404,7 +4394,7 @@ ROM_START( uopokoj )
 	ROM_LOAD16_BYTE( "u26.bin", 0x000000, 0x080000, CRC(e7eec050) SHA1(cf3a77741029f96dbbec5ca7217a1723e4233cff) )
 	ROM_LOAD16_BYTE( "u25.bin", 0x000001, 0x080000, CRC(68cb6211) SHA1(a6db0bc2e3e54b6992a44b7d52395917e66db49b) )
 
-	ROM_REGION( 0x400000 * 2, "sprites", 0 )        /* Sprites: * 2 */
+	ROM_REGION( 0x400000, "sprites", 0 )            /* Sprites */
 	ROM_LOAD( "u33.bin", 0x000000, 0x400000, CRC(5d142ad2) SHA1(f26abcf7a625a322b83df44fbd6e852bfb03663c) )
 
 	ROM_REGION( 0x400000, "layer0", 0 ) /* Layer 0 */
@@ -4456,6 +4446,7 @@ static void init_cave(running_machine &machine)
 	cave_state *state = machine.driver_data<cave_state>();
 
 	state->m_spritetype[0] = 0; // Normal sprites
+	state->m_sprite_packed = 0;
 	state->m_kludge = 0;
 	state->m_time_vblank_irq = 100;
 
@@ -4481,14 +4472,14 @@ DRIVER_INIT_MEMBER(cave_state,agallet)
 
 	sailormn_unpack_tiles(machine(), "layer2");
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 }
 
 DRIVER_INIT_MEMBER(cave_state,dfeveron)
 {
 	init_cave(machine());
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_kludge = 2;
 }
 
@@ -4496,7 +4487,7 @@ DRIVER_INIT_MEMBER(cave_state,feversos)
 {
 	init_cave(machine());
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_kludge = 2;
 }
 
@@ -4504,7 +4495,7 @@ DRIVER_INIT_MEMBER(cave_state,ddonpach)
 {
 	init_cave(machine());
 
-	ddonpach_unpack_sprites(machine());
+	ddonpach_setup_packed_sprites(machine());
 	m_spritetype[0] = 1;    // "different" sprites (no zooming?)
 	m_time_vblank_irq = 90;
 }
@@ -4513,7 +4504,7 @@ DRIVER_INIT_MEMBER(cave_state,donpachi)
 {
 	init_cave(machine());
 
-	ddonpach_unpack_sprites(machine());
+	ddonpach_setup_packed_sprites(machine());
 	m_spritetype[0] = 1;    // "different" sprites (no zooming?)
 	m_time_vblank_irq = 90;
 }
@@ -4540,7 +4531,7 @@ DRIVER_INIT_MEMBER(cave_state,gaia)
 
 	/* No EEPROM */
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_spritetype[0] = 2;    // Normal sprites with different position handling
 	m_time_vblank_irq = 2000;   /**/
 }
@@ -4566,7 +4557,7 @@ DRIVER_INIT_MEMBER(cave_state,hotdogst)
 	membank("bank3")->configure_entries(0, 4, &ROM[0x00000], 0x20000);
 	membank("bank4")->configure_entries(0, 4, &ROM[0x00000], 0x20000);
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_spritetype[0] = 2;    // Normal sprites with different position handling
 	m_time_vblank_irq = 2000;   /**/
 }
@@ -4597,7 +4588,7 @@ DRIVER_INIT_MEMBER(cave_state,mazinger)
 		auto_free(machine(), buffer);
 	}
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_spritetype[0] = 2;    // Normal sprites with different position handling
 	m_kludge = 3;
 	m_time_vblank_irq = 2100;
@@ -4624,7 +4615,7 @@ DRIVER_INIT_MEMBER(cave_state,metmqstr)
 	membank("bank5")->configure_entries(0, 8, &ROM[0x00000], 0x20000);
 	membank("bank6")->configure_entries(0, 8, &ROM[0x00000], 0x20000);
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_spritetype[0] = 2;    // Normal sprites with different position handling
 	m_kludge = 3;
 	m_time_vblank_irq = 17376;
@@ -4646,7 +4637,7 @@ DRIVER_INIT_MEMBER(cave_state,pwrinst2j)
 
 	buffer = auto_alloc_array(machine(), UINT8, len);
 	{
-		for(i = 0; i < len/2; i++)
+		for(i = 0; i < len; i++)
 		{
 			j = BITSWAP24(i,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,7, 2,4,6,1,5,3, 0);
 			if(((j & 6) == 0) || ((j & 6) == 6))
@@ -4658,7 +4649,7 @@ DRIVER_INIT_MEMBER(cave_state,pwrinst2j)
 		auto_free(machine(), buffer);
 	}
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_spritetype[0] = 3;
 	m_kludge = 4;
 	m_time_vblank_irq = 2000;   /**/
@@ -4711,7 +4702,7 @@ DRIVER_INIT_MEMBER(cave_state,sailormn)
 
 	sailormn_unpack_tiles( machine(), "layer2" );
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_spritetype[0] = 2;    // Normal sprites with different position handling
 	m_kludge = 1;
 	m_time_vblank_irq = 2000;
@@ -4724,7 +4715,7 @@ DRIVER_INIT_MEMBER(cave_state,tjumpman)
 {
 	init_cave(machine());
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_spritetype[0] = 2;    // Normal sprites with different position handling
 	m_kludge = 3;
 	m_time_vblank_irq = 17376;
@@ -4737,7 +4728,7 @@ DRIVER_INIT_MEMBER(cave_state,uopoko)
 {
 	init_cave(machine());
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_kludge = 2;
 	m_time_vblank_irq = 2000;   /**/
 }
@@ -4748,7 +4739,7 @@ DRIVER_INIT_MEMBER(cave_state,korokoro)
 
 	m_irq_level = 2;
 
-	unpack_sprites(machine());
+	setup_packed_sprites(machine());
 	m_time_vblank_irq = 2000;   /**/
 
 	m_leds[0] = 0;
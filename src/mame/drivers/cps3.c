@@ -726,8 +726,10 @@ static void init_common(running_machine &machine, UINT32 key1, UINT32 key2, int
 	if (!state->m_user4region) state->m_user4region = auto_alloc_array(machine, UINT8, USER4REGION_LENGTH);
 	if (!state->m_user5region) state->m_user5region = auto_alloc_array(machine, UINT8, USER5REGION_LENGTH);
 
-	// set strict verify
-	sh2drc_set_options(machine.device("maincpu"), SH2DRC_STRICT_VERIFY);
+	// the code the game copies to 0xc0000000 RAM is tracked by its write handler
+	// instead of strictly verifying every block on entry
+	sh2drc_set_options(machine.device("maincpu"), SH2DRC_FASTEST_OPTIONS);
+	sh2drc_add_code_watch(machine.device("maincpu"), 0xc0000000, 0xc00003ff);
 
 	cps3_decrypt_bios(machine);
 	state->m_decrypted_gamerom = auto_alloc_array(machine, UINT32, 0x1000000/4);
@@ -1295,6 +1297,7 @@ WRITE32_MEMBER(cps3_state::cps3_0xc0000000_ram_w)
 	COMBINE_DATA( &m_0xc0000000_ram[offset] );
 	// store a decrypted copy
 	m_0xc0000000_ram_decrypted[offset] = m_0xc0000000_ram[offset]^cps3_mask(offset*4+0xc0000000, m_key1, m_key2);
+	sh2drc_code_written(m_maincpu, offset*4+0xc0000000);
 }
 
 
@@ -2063,6 +2063,20 @@ READ32_MEMBER(seibuspi_state::rfjet_speedup_r)
 	return m_spimainram[(0x002894c-0x800)/4];
 }
 
+/* the background and sprite decryption is slow, so the result is kept in the ROM cache when enabled */
+static bool spi_gfx_cache_load(running_machine &machine, const char *tag, UINT32 &key)
+{
+	memory_region *region = machine.root_device().memregion(tag);
+	key = rom_cache_key(machine, region->base(), region->bytes());
+	return rom_cache_load(machine, tag, key, region->base(), region->bytes());
+}
+
+static void spi_gfx_cache_save(running_machine &machine, const char *tag, UINT32 key)
+{
+	memory_region *region = machine.root_device().memregion(tag);
+	rom_cache_save(machine, tag, key, region->base(), region->bytes());
+}
+
 static void init_spi(running_machine &machine)
 {
 	seibuspi_state *state = machine.driver_data<seibuspi_state>();
@@ -2070,8 +2084,30 @@ static void init_spi(running_machine &machine)
 	state->m_flash[1] = machine.device<intel_e28f008sa_device>("flash1");
 
 	seibuspi_text_decrypt(state->memregion("gfx1")->base());
-	seibuspi_bg_decrypt(state->memregion("gfx2")->base(), state->memregion("gfx2")->bytes());
-	seibuspi_sprite_decrypt(state->memregion("gfx3")->base(), 0x400000);
+
+	UINT32 key;
+	if (!spi_gfx_cache_load(machine, "gfx2", key))
+	{
+		seibuspi_bg_decrypt(state->memregion("gfx2")->base(), state->memregion("gfx2")->bytes());
+		spi_gfx_cache_save(machine, "gfx2", key);
+	}
+	if (!spi_gfx_cache_load(machine, "gfx3", key))
+	{
+		seibuspi_sprite_decrypt(state->memregion("gfx3")->base(), 0x400000);
+		spi_gfx_cache_save(machine, "gfx3", key);
+	}
+}
+
+// decryption self-test; the kernels are shared by every SPI set, so only the first driver runs it
+void seibuspi_state::device_validity_check(validity_checker &valid) const
+{
+	static bool tested = false;
+
+	if (!tested)
+	{
+		tested = true;
+		seibuspi_decrypt_selftest();
+	}
 }
 
 DRIVER_INIT_MEMBER(seibuspi_state,rdft)
@@ -2134,8 +2170,18 @@ static void init_rf2_common(running_machine &machine)
 
 	machine.device("maincpu")->memory().space(AS_PROGRAM).install_read_handler(0x0282AC, 0x0282AF, read32_delegate(FUNC(seibuspi_state::rf2_speedup_r),state));
 	seibuspi_rise10_text_decrypt(state->memregion("gfx1")->base());
-	seibuspi_rise10_bg_decrypt(state->memregion("gfx2")->base(), state->memregion("gfx2")->bytes());
-	seibuspi_rise10_sprite_decrypt(state->memregion("gfx3")->base(), 0x600000);
+
+	UINT32 key;
+	if (!spi_gfx_cache_load(machine, "gfx2", key))
+	{
+		seibuspi_rise10_bg_decrypt(state->memregion("gfx2")->base(), state->memregion("gfx2")->bytes());
+		spi_gfx_cache_save(machine, "gfx2", key);
+	}
+	if (!spi_gfx_cache_load(machine, "gfx3", key))
+	{
+		seibuspi_rise10_sprite_decrypt(state->memregion("gfx3")->base(), 0x600000);
+		spi_gfx_cache_save(machine, "gfx3", key);
+	}
 
 	machine.device("maincpu")->memory().space(AS_PROGRAM).install_write_handler(0x560, 0x563, write32_delegate(FUNC(seibuspi_state::sprite_dma_start_w),state));
 }
@@ -2159,8 +2205,18 @@ static void init_rfjet_common(running_machine &machine)
 
 	machine.device("maincpu")->memory().space(AS_PROGRAM).install_read_handler(0x002894c, 0x002894f, read32_delegate(FUNC(seibuspi_state::rfjet_speedup_r),state));
 	seibuspi_rise11_text_decrypt(state->memregion("gfx1")->base());
-	seibuspi_rise11_bg_decrypt(state->memregion("gfx2")->base(), state->memregion("gfx2")->bytes());
-	seibuspi_rise11_sprite_decrypt_rfjet(state->memregion("gfx3")->base(), 0x800000);
+
+	UINT32 key;
+	if (!spi_gfx_cache_load(machine, "gfx2", key))
+	{
+		seibuspi_rise11_bg_decrypt(state->memregion("gfx2")->base(), state->memregion("gfx2")->bytes());
+		spi_gfx_cache_save(machine, "gfx2", key);
+	}
+	if (!spi_gfx_cache_load(machine, "gfx3", key))
+	{
+		seibuspi_rise11_sprite_decrypt_rfjet(state->memregion("gfx3")->base(), 0x800000);
+		spi_gfx_cache_save(machine, "gfx3", key);
+	}
 
 	machine.device("maincpu")->memory().space(AS_PROGRAM).install_write_handler(0x560, 0x563, write32_delegate(FUNC(seibuspi_state::sprite_dma_start_w),state));
 }
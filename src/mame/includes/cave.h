@@ -81,6 +81,7 @@ public:
 	int          m_background_color;
 
 	int          m_spritetype[2];
+	int          m_sprite_packed;   // sprite pens stored two per byte (even pixel in the low nibble)
 	int          m_kludge;
 
 
@@ -272,6 +272,9 @@ public:
 	DECLARE_WRITE16_MEMBER(sf2mdt_layer_w);
 	DECLARE_WRITE16_MEMBER(sf2mdta_layer_w);
 	UINT32 screen_update_fcrash(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect);
+
+protected:
+	virtual void device_validity_check(validity_checker &valid) const;
 };
 
 /*----------- defined in drivers/cps1.c -----------*/
@@ -20,7 +20,8 @@ public:
 		m_tilemap40_regs_base(*this, "tmap40_regs"),
 		m_tilemap50_regs_base(*this, "tmap50_regs"),
 		m_fullscreenzoom(*this, "fullscreenzoom"),
-		m_0xc0000000_ram(*this, "0xc0000000_ram"){ }
+		m_0xc0000000_ram(*this, "0xc0000000_ram"),
+		m_maincpu(*this, "maincpu"){ }
 
 	required_shared_ptr<UINT32> m_mainram;
 	required_shared_ptr<UINT32> m_spriteram;
@@ -31,6 +32,7 @@ public:
 	required_shared_ptr<UINT32> m_tilemap50_regs_base;
 	required_shared_ptr<UINT32> m_fullscreenzoom;
 	required_shared_ptr<UINT32> m_0xc0000000_ram;
+	required_device<cpu_device> m_maincpu;
 
 	fujitsu_29f016a_device *m_simm[7][8];
 	UINT32* m_decrypted_bios;
@@ -630,54 +630,45 @@ static void optimise_sboxes(struct optimised_sbox* out, const struct sbox* in)
 
 
 
-static void cps2_decrypt(running_machine &machine, const UINT32 *master_key, UINT32 upper_limit)
-{
-	address_space &space = machine.device("maincpu")->memory().space(AS_PROGRAM);
-	UINT16 *rom = (UINT16 *)machine.root_device().memregion("maincpu")->base();
-	int length = machine.root_device().memregion("maincpu")->bytes();
-	UINT16 *dec = auto_alloc_array(machine, UINT16, length/2);
-	int i;
-	UINT32 key1[4];
-	struct optimised_sbox sboxes1[4*4];
-	struct optimised_sbox sboxes2[4*4];
-
-	optimise_sboxes(&sboxes1[0*4], fn1_r1_boxes);
-	optimise_sboxes(&sboxes1[1*4], fn1_r2_boxes);
-	optimise_sboxes(&sboxes1[2*4], fn1_r3_boxes);
-	optimise_sboxes(&sboxes1[3*4], fn1_r4_boxes);
-	optimise_sboxes(&sboxes2[0*4], fn2_r1_boxes);
-	optimise_sboxes(&sboxes2[1*4], fn2_r2_boxes);
-	optimise_sboxes(&sboxes2[2*4], fn2_r3_boxes);
-	optimise_sboxes(&sboxes2[3*4], fn2_r4_boxes);
+// each work item decrypts the addresses belonging to a range of the 0x10000 subkeys
+#define CPS2_DECRYPT_SLICES 16
 
+struct cps2_decrypt_slice
+{
+	const UINT16 *rom;
+	UINT16 *dec;
+	int length;
+	UINT32 upper_limit;
+	const UINT32 *master_key;
+	const UINT32 *key1;
+	const struct optimised_sbox *sboxes1;
+	const struct optimised_sbox *sboxes2;
+	int start;
+	int end;
+	INT32 volatile *done;
+};
 
-	// expand master key to 1st FN 96-bit key
-	expand_1st_key(key1, master_key);
 
-	// add extra bits for s-boxes with less than 6 inputs
-	key1[0] ^= BIT(key1[0], 1) <<  4;
-	key1[0] ^= BIT(key1[0], 2) <<  5;
-	key1[0] ^= BIT(key1[0], 8) << 11;
-	key1[1] ^= BIT(key1[1], 0) <<  5;
-	key1[1] ^= BIT(key1[1], 8) << 11;
-	key1[2] ^= BIT(key1[2], 1) <<  5;
-	key1[2] ^= BIT(key1[2], 8) << 11;
+static void *cps2_decrypt_slice_callback(void *param, int threadid)
+{
+	const cps2_decrypt_slice *slice = (const cps2_decrypt_slice *)param;
+	const UINT16 *rom = slice->rom;
+	UINT16 *dec = slice->dec;
+	int length = slice->length;
+	UINT32 upper_limit = slice->upper_limit;
+	const UINT32 *master_key = slice->master_key;
+	const UINT32 *key1 = slice->key1;
+	const struct optimised_sbox *sboxes1 = slice->sboxes1;
+	const struct optimised_sbox *sboxes2 = slice->sboxes2;
+	int i;
 
-	for (i = 0; i < 0x10000; ++i)
+	for (i = slice->start; i < slice->end; ++i)
 	{
 		int a;
 		UINT16 seed;
 		UINT32 subkey[2];
 		UINT32 key2[4];
 
-		if ((i & 0xff) == 0)
-		{
-			char loadingMessage[256]; // for displaying with UI
-			sprintf(loadingMessage, _("Decrypting %d%%"), i*100/0x10000);
-			ui_set_startup_text(machine, loadingMessage,FALSE);
-		}
-
-
 		// pass the address through FN1
 		seed = feistel(i, fn1_groupA, fn1_groupB,
 				&sboxes1[0*4], &sboxes1[1*4], &sboxes1[2*4], &sboxes1[3*4],
@@ -720,11 +711,139 @@ static void cps2_decrypt(running_machine &machine, const UINT32 *master_key, UIN
 		}
 	}
 
+	atomic_increment32(slice->done);
+	return NULL;
+}
+
+
+// machine is only used for the progress display and may be NULL; serial runs every subkey as one slice
+static void cps2_decrypt_opcodes(running_machine *machine, const UINT16 *rom, UINT16 *dec, int length, const UINT32 *master_key, UINT32 upper_limit, bool serial = false)
+{
+	int i;
+	UINT32 key1[4];
+	struct optimised_sbox sboxes1[4*4];
+	struct optimised_sbox sboxes2[4*4];
+	cps2_decrypt_slice slices[CPS2_DECRYPT_SLICES];
+	INT32 volatile done = 0;
+	char loadingMessage[256]; // for displaying with UI
+
+	optimise_sboxes(&sboxes1[0*4], fn1_r1_boxes);
+	optimise_sboxes(&sboxes1[1*4], fn1_r2_boxes);
+	optimise_sboxes(&sboxes1[2*4], fn1_r3_boxes);
+	optimise_sboxes(&sboxes1[3*4], fn1_r4_boxes);
+	optimise_sboxes(&sboxes2[0*4], fn2_r1_boxes);
+	optimise_sboxes(&sboxes2[1*4], fn2_r2_boxes);
+	optimise_sboxes(&sboxes2[2*4], fn2_r3_boxes);
+	optimise_sboxes(&sboxes2[3*4], fn2_r4_boxes);
+
+
+	// expand master key to 1st FN 96-bit key
+	expand_1st_key(key1, master_key);
+
+	// add extra bits for s-boxes with less than 6 inputs
+	key1[0] ^= BIT(key1[0], 1) <<  4;
+	key1[0] ^= BIT(key1[0], 2) <<  5;
+	key1[0] ^= BIT(key1[0], 8) << 11;
+	key1[1] ^= BIT(key1[1], 0) <<  5;
+	key1[1] ^= BIT(key1[1], 8) << 11;
+	key1[2] ^= BIT(key1[2], 1) <<  5;
+	key1[2] ^= BIT(key1[2], 8) << 11;
+
+	// every subkey only touches its own addresses, so the subkeys can be split freely
+	for (i = 0; i < CPS2_DECRYPT_SLICES; ++i)
+	{
+		slices[i].rom = rom;
+		slices[i].dec = dec;
+		slices[i].length = length;
+		slices[i].upper_limit = upper_limit;
+		slices[i].master_key = master_key;
+		slices[i].key1 = key1;
+		slices[i].sboxes1 = sboxes1;
+		slices[i].sboxes2 = sboxes2;
+		slices[i].start = i * (0x10000 / CPS2_DECRYPT_SLICES);
+		slices[i].end = (i + 1) * (0x10000 / CPS2_DECRYPT_SLICES);
+		slices[i].done = &done;
+	}
+
+	if (serial)
+	{
+		slices[0].end = 0x10000;
+		cps2_decrypt_slice_callback(&slices[0], 0);
+		return;
+	}
+
+	if (machine != NULL)
+	{
+		sprintf(loadingMessage, _("Decrypting %d%%"), 0);
+		ui_set_startup_text(*machine, loadingMessage,FALSE);
+	}
+
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (queue == NULL)
+	{
+		for (i = 0; i < CPS2_DECRYPT_SLICES; ++i)
+			cps2_decrypt_slice_callback(&slices[i], 0);
+		return;
+	}
+
+	osd_work_item_queue_multiple(queue, cps2_decrypt_slice_callback, CPS2_DECRYPT_SLICES, slices, sizeof(slices[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+	// keep the progress display going while the slices run
+	while (!osd_work_queue_wait(queue, osd_ticks_per_second() / 10))
+		if (machine != NULL)
+		{
+			sprintf(loadingMessage, _("Decrypting %d%%"), done * 100 / CPS2_DECRYPT_SLICES);
+			ui_set_startup_text(*machine, loadingMessage,FALSE);
+		}
+	osd_work_queue_free(queue);
+}
+
+
+static void cps2_decrypt(running_machine &machine, const UINT32 *master_key, UINT32 upper_limit)
+{
+	address_space &space = machine.device("maincpu")->memory().space(AS_PROGRAM);
+	UINT16 *rom = (UINT16 *)machine.root_device().memregion("maincpu")->base();
+	int length = machine.root_device().memregion("maincpu")->bytes();
+	UINT16 *dec = auto_alloc_array(machine, UINT16, length/2);
+
+	// the decrypted opcodes only depend on the ROM contents and the key
+	UINT32 cachekey = rom_cache_key(machine, rom, length);
+	if (!rom_cache_load(machine, "opcodes", cachekey, dec, length))
+	{
+		cps2_decrypt_opcodes(&machine, rom, dec, length, master_key, upper_limit);
+		rom_cache_save(machine, "opcodes", cachekey, dec, length);
+	}
+
 	space.set_decrypted_region(0x000000, length - 1, dec);
 	m68k_set_encrypted_opcode_range(machine.device("maincpu"), 0, length);
 }
 
 
+// -validate self-test: the sliced decryption must match one pass over all the subkeys
+static void cps2_decrypt_selftest()
+{
+	static const UINT32 master_key[2] = { 0x4b5f9c0d, 0x2e6a81f3 };
+	const int length = 0x40000;
+	const UINT32 upper_limit = 0x30000;     // leaves an unencrypted tail, as some sets do
+
+	dynamic_array<UINT16> rom(length/2), serial(length/2), sliced(length/2);
+	UINT32 seed = 0x12345678;
+	for (int a = 0; a < length/2; a++)
+	{
+		seed = seed * 1103515245 + 12345;
+		rom[a] = seed >> 16;
+	}
+
+	cps2_decrypt_opcodes(NULL, rom, serial, length, master_key, upper_limit, true);
+	cps2_decrypt_opcodes(NULL, rom, sliced, length, master_key, upper_limit);
+
+	UINT32 serialcrc = crc32_creator::simple(serial, length);
+	UINT32 slicedcrc = crc32_creator::simple(sliced, length);
+	if (serialcrc != slicedcrc)
+		mame_printf_error("CPS2 sliced opcode decryption CRC %08X does not match serial CRC %08X\n", slicedcrc, serialcrc);
+}
+
+
 
 
 
@@ -994,6 +1113,19 @@ static const struct game_keys keys_table[] =
 
 
 
+// the decryption self-test does not depend on the driver, so one run covers every CPS2 set
+void cps_state::device_validity_check(validity_checker &valid) const
+{
+	static bool tested = false;
+
+	if (!tested)
+	{
+		tested = true;
+		cps2_decrypt_selftest();
+	}
+}
+
+
 DRIVER_INIT_MEMBER(cps_state,cps2crpt)
 {
 	const char *gamename = machine().system().name;
@@ -2,6 +2,72 @@
 #include "machine/seibuspi.h"
 
 
+/**************************************************************************
+
+Parallel decryption
+-------------------
+
+Every word of the tile and sprite ROMs is decrypted independently of the
+others, so the large regions are split into slices which are decrypted
+on the work queue threads.
+
+**************************************************************************/
+
+#define DECRYPT_SLICES  16
+
+struct decrypt_slice
+{
+	seibuspi_decrypt_func   func;
+	UINT8 *                 rom;
+	int                     size;
+	int                     start;
+	int                     end;
+	const seibuspi_decrypt_keys *keys;
+};
+
+static void *decrypt_slice_callback(void *param, int threadid)
+{
+	decrypt_slice *slice = (decrypt_slice *)param;
+	(*slice->func)(slice->rom, slice->size, slice->start, slice->end, slice->keys);
+	return NULL;
+}
+
+/* run func over [0, count) in slices whose bounds are multiples of align */
+void seibuspi_decrypt_parallel(seibuspi_decrypt_func func, UINT8 *rom, int size, int count, int align, const seibuspi_decrypt_keys *keys)
+{
+	decrypt_slice slices[DECRYPT_SLICES];
+	int step, start, numslices = 0;
+
+	if (count <= 0)
+		return;
+
+	step = (count + DECRYPT_SLICES - 1) / DECRYPT_SLICES;
+	step = (step + align - 1) / align * align;
+	for (start = 0; start < count; start += step)
+	{
+		decrypt_slice &slice = slices[numslices++];
+		slice.func = func;
+		slice.rom = rom;
+		slice.size = size;
+		slice.start = start;
+		slice.end = MIN(start + step, count);
+		slice.keys = keys;
+	}
+
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (queue == NULL)
+	{
+		(*func)(rom, size, 0, count, keys);
+		return;
+	}
+
+	osd_work_item_queue_multiple(queue, decrypt_slice_callback, numslices, slices, sizeof(slices[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+		;
+	osd_work_queue_free(queue);
+}
+
+
 
 /**************************************************************************
 
@@ -94,26 +160,34 @@ static void decrypt_text(UINT8 *rom, UINT32 key1, UINT32 key2, UINT32 key3)
 	}
 }
 
-static void decrypt_bg(UINT8 *rom, int size, UINT32 key1, UINT32 key2, UINT32 key3)
+/* tiles [start, end) counted across all 0xc0000 byte banks */
+static void decrypt_bg_slice(UINT8 *rom, int size, int start, int end, const seibuspi_decrypt_keys *keys)
 {
-	int i,j;
-	for(j=0; j<size; j+=0xc0000)
+	int k;
+	for(k=start; k<end; k++)
 	{
-		for(i=0; i<0x40000; i++)
-		{
-			UINT32 w;
+		int j = (k / 0x40000) * 0xc0000;
+		int i = k % 0x40000;
+		UINT32 w;
 
-			w = (rom[j + (i*3) + 0] << 16) | (rom[j + (i*3) + 1] << 8) | (rom[j + (i*3) + 2]);
+		w = (rom[j + (i*3) + 0] << 16) | (rom[j + (i*3) + 1] << 8) | (rom[j + (i*3) + 2]);
 
-			w = decrypt_tile(w, i >> 6, key1, key2, key3);
+		w = decrypt_tile(w, i >> 6, keys->key[0], keys->key[1], keys->key[2]);
 
-			rom[j + (i*3) + 0] = (w >> 16) & 0xff;
-			rom[j + (i*3) + 1] = (w >> 8) & 0xff;
-			rom[j + (i*3) + 2] = w & 0xff;
-		}
+		rom[j + (i*3) + 0] = (w >> 16) & 0xff;
+		rom[j + (i*3) + 1] = (w >> 8) & 0xff;
+		rom[j + (i*3) + 2] = w & 0xff;
 	}
 }
 
+static void decrypt_bg(UINT8 *rom, int size, UINT32 key1, UINT32 key2, UINT32 key3)
+{
+	seibuspi_decrypt_keys keys = { { key1, key2, key3 } };
+	int banks = (size + 0xc0000 - 1) / 0xc0000;
+
+	seibuspi_decrypt_parallel(decrypt_bg_slice, rom, size, banks * 0x40000, 1, &keys);
+}
+
 /******************************************************************************************
 cpu #0 (PC=0033B2EB): unmapped program memory dword write to 00000414 = 00000000 & 0000FFFF
 cpu #0 (PC=0033B2EB): unmapped program memory dword write to 00000414 = 0000DF5B & 0000FFFF
@@ -219,11 +293,12 @@ static void sprite_reorder(UINT8 *buffer)
 	memcpy(buffer, temp, 64);
 }
 
-void seibuspi_rise10_sprite_decrypt(UINT8 *rom, int size)
+/* words [start, end) of each plane; start is a multiple of 32 */
+static void rise10_sprite_decrypt_slice(UINT8 *rom, int size, int start, int end, const seibuspi_decrypt_keys *keys)
 {
 	int i;
 
-	for (i = 0; i < size/2; i++)
+	for (i = start; i < end; i++)
 	{
 		UINT32 plane54,plane3210;
 
@@ -246,7 +321,7 @@ void seibuspi_rise10_sprite_decrypt(UINT8 *rom, int size)
 		rom[2*size+2*i+1] = plane3210 >>  0;
 	}
 
-	for (i = 0; i < size/2; i += 32)
+	for (i = start; i < end; i += 32)
 	{
 		sprite_reorder(&rom[0*size+2*i]);
 		sprite_reorder(&rom[1*size+2*i]);
@@ -254,6 +329,11 @@ void seibuspi_rise10_sprite_decrypt(UINT8 *rom, int size)
 	}
 }
 
+void seibuspi_rise10_sprite_decrypt(UINT8 *rom, int size)
+{
+	seibuspi_decrypt_parallel(rise10_sprite_decrypt_slice, rom, size, size/2, 32, NULL);
+}
+
 
 
 
@@ -302,12 +382,14 @@ CPU 'main' (PC=00021C74): unmapped program memory dword write to 0601004C = 0300
 ******************************************************************************************/
 
 
-static void seibuspi_rise11_sprite_decrypt(UINT8 *rom, int size,
-	UINT32 k1, UINT32 k2, UINT32 k3, UINT32 k4, UINT32 k5, int feversoc_kludge)
+/* words [start, end) of each plane; start is a multiple of 32 */
+static void rise11_sprite_decrypt_slice(UINT8 *rom, int size, int start, int end, const seibuspi_decrypt_keys *keys)
 {
+	UINT32 k1 = keys->key[0], k2 = keys->key[1], k3 = keys->key[2], k4 = keys->key[3], k5 = keys->key[4];
+	int feversoc_kludge = keys->feversoc_kludge;
 	int i;
 
-	for (i = 0; i < size/2; i++)
+	for (i = start; i < end; i++)
 	{
 		UINT16 b1,b2,b3;
 		UINT32 plane543,plane210;
@@ -379,7 +461,7 @@ static void seibuspi_rise11_sprite_decrypt(UINT8 *rom, int size,
 		rom[2*size+2*i+1] = plane210 >>  0;
 	}
 
-	for (i = 0; i < size/2; i += 32)
+	for (i = start; i < end; i += 32)
 	{
 		sprite_reorder(&rom[0*size+2*i]);
 		sprite_reorder(&rom[1*size+2*i]);
@@ -387,6 +469,14 @@ static void seibuspi_rise11_sprite_decrypt(UINT8 *rom, int size,
 	}
 }
 
+static void seibuspi_rise11_sprite_decrypt(UINT8 *rom, int size,
+	UINT32 k1, UINT32 k2, UINT32 k3, UINT32 k4, UINT32 k5, int feversoc_kludge)
+{
+	seibuspi_decrypt_keys keys = { { k1, k2, k3, k4, k5 }, feversoc_kludge };
+
+	seibuspi_decrypt_parallel(rise11_sprite_decrypt_slice, rom, size, size/2, 32, &keys);
+}
+
 
 void seibuspi_rise11_sprite_decrypt_rfjet(UINT8 *rom, int size)
 {
@@ -398,3 +488,46 @@ void seibuspi_rise11_sprite_decrypt_feversoc(UINT8 *rom, int size)
 {
 	seibuspi_rise11_sprite_decrypt(rom, size, 0x9df5b2, 0x9ae999, 0x4a32e9, 0x968bd5, 0x1d97ac, 1);
 }
+
+
+
+/******************************************************************************************
+
+Self-test, run from -validate: each kernel is run once over the whole of a generated
+buffer and once through seibuspi_decrypt_parallel, and the two results must match.
+
+******************************************************************************************/
+
+static void selftest_kernel(const char *name, seibuspi_decrypt_func func, int size, int length, int count, int align, const seibuspi_decrypt_keys *keys)
+{
+	dynamic_buffer serial(length), sliced(length);
+	UINT32 seed = 0x2468ace1;
+	for (int i = 0; i < length; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		serial[i] = sliced[i] = seed >> 16;
+	}
+
+	(*func)(serial, size, 0, count, keys);
+	seibuspi_decrypt_parallel(func, sliced, size, count, align, keys);
+
+	UINT32 serialcrc = crc32_creator::simple(serial, length);
+	UINT32 slicedcrc = crc32_creator::simple(sliced, length);
+	if (serialcrc != slicedcrc)
+		mame_printf_error("Seibu SPI %s sliced decryption CRC %08X does not match serial CRC %08X\n", name, slicedcrc, serialcrc);
+}
+
+void seibuspi_decrypt_selftest()
+{
+	static const seibuspi_decrypt_keys bg_keys = { { 0x5a3845, 0x77cf5b, 0x1378df } };
+	static const seibuspi_decrypt_keys rfjet_keys = { { 0xabcb64, 0x55aadd, 0xab6a4c, 0xd6375b, 0x8bf23b }, 0 };
+	static const seibuspi_decrypt_keys feversoc_keys = { { 0x9df5b2, 0x9ae999, 0x4a32e9, 0x968bd5, 0x1d97ac }, 1 };
+	const int bgsize = 2 * 0xc0000;
+	const int spritesize = 0x10000;     // per plane
+
+	selftest_kernel("tile", decrypt_bg_slice, bgsize, bgsize, 2 * 0x40000, 1, &bg_keys);
+	selftest_kernel("sprite", seibuspi_sprite_decrypt_slice, spritesize, 3 * spritesize, spritesize/2, 1, NULL);
+	selftest_kernel("RISE10 sprite", rise10_sprite_decrypt_slice, spritesize, 3 * spritesize, spritesize/2, 32, NULL);
+	selftest_kernel("RISE11 sprite", rise11_sprite_decrypt_slice, spritesize, 3 * spritesize, spritesize/2, 32, &rfjet_keys);
+	selftest_kernel("RISE11 feversoc sprite", rise11_sprite_decrypt_slice, spritesize, 3 * spritesize, spritesize/2, 32, &feversoc_keys);
+}
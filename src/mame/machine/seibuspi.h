@@ -1,5 +1,16 @@
 UINT32 partial_carry_sum32(UINT32 add1,UINT32 add2,UINT32 carry_mask);
 
+struct seibuspi_decrypt_keys
+{
+	UINT32  key[5];             // per-kernel keys
+	int     feversoc_kludge;    // RISE11 sprites: feversoc variant
+};
+
+typedef void (*seibuspi_decrypt_func)(UINT8 *rom, int size, int start, int end, const seibuspi_decrypt_keys *keys);
+void seibuspi_decrypt_parallel(seibuspi_decrypt_func func, UINT8 *rom, int size, int count, int align, const seibuspi_decrypt_keys *keys);
+
+void seibuspi_decrypt_selftest();
+
 void seibuspi_text_decrypt(UINT8 *rom);
 void seibuspi_bg_decrypt(UINT8 *rom, int size);
 
@@ -11,3 +22,6 @@ void seibuspi_rise11_text_decrypt(UINT8 *rom);
 void seibuspi_rise11_bg_decrypt(UINT8 *rom, int size);
 void seibuspi_rise11_sprite_decrypt_rfjet(UINT8 *rom, int romsize);
 void seibuspi_rise11_sprite_decrypt_feversoc(UINT8 *rom, int romsize);
+
+/* in machine/spisprit.c */
+void seibuspi_sprite_decrypt_slice(UINT8 *src, int rom_size, int start, int end, const seibuspi_decrypt_keys *keys);
@@ -13,6 +13,7 @@ cpu #0 (PC=0033C315): unmapped program memory dword write to 00000524 = 9CAC0000
 
 #include "emu.h"
 #include "includes/seibuspi.h"
+#include "machine/seibuspi.h"
 
 // add two numbers generating carry from one bit to the next only if
 // the corresponding bit in carry_mask is 1
@@ -129,12 +130,12 @@ static int key(int table,int addr)
 }
 
 
-void seibuspi_sprite_decrypt(UINT8 *src, int rom_size)
+void seibuspi_sprite_decrypt_slice(UINT8 *src, int rom_size, int start, int end, const seibuspi_decrypt_keys *keys)
 {
 	int i;
 
 
-	for(i = 0; i < rom_size/2; i++)
+	for(i = start; i < end; i++)
 	{
 		int j;
 		int addr = i>>8;
@@ -281,3 +282,8 @@ void seibuspi_sprite_decrypt(UINT8 *src, int rom_size)
 		src[2*i+2*rom_size+1] = plane0;
 	}
 }
+
+void seibuspi_sprite_decrypt(UINT8 *src, int rom_size)
+{
+	seibuspi_decrypt_parallel(seibuspi_sprite_decrypt_slice, src, rom_size, rom_size/2, 1, NULL);
+}
@@ -507,7 +507,7 @@ static void get_sprite_info_cave( running_machine &machine )
 	cave_state *state = machine.driver_data<cave_state>();
 	pen_t base_pal = 0;
 	const UINT8 *base_gfx = state->memregion("sprites")->base();
-	int code_max = state->memregion("sprites")->bytes() / (16*16);
+	int code_max = state->memregion("sprites")->bytes() / ((16*16) >> state->m_sprite_packed);
 
 	UINT16 *source;
 	UINT16 *finish;
@@ -557,7 +557,7 @@ static void get_sprite_info_cave( running_machine &machine )
 
 		/* Bound checking */
 		code %= code_max;
-		sprite->pen_data = base_gfx + (16 * 16) * code;
+		sprite->pen_data = base_gfx + ((16 * 16) >> state->m_sprite_packed) * code;
 
 		flipx = attr & 0x0008;
 		flipy = attr & 0x0004;
@@ -614,7 +614,7 @@ static void get_sprite_info_cave( running_machine &machine )
 
 		sprite->priority    = (attr & 0x0030) >> 4;
 		sprite->flags       = SPRITE_VISIBLE_CAVE;
-		sprite->line_offset = sprite->tile_width;
+		sprite->line_offset = sprite->tile_width >> state->m_sprite_packed;
 		sprite->base_pen    = base_pal + (attr & 0x3f00);   // first 0x4000 colors
 
 		if (glob_flipx) { x = max_x - x - sprite->total_width;  flipx = !flipx; }
@@ -636,7 +636,7 @@ static void get_sprite_info_donpachi( running_machine &machine )
 	cave_state *state = machine.driver_data<cave_state>();
 	pen_t base_pal = 0;
 	const UINT8 *base_gfx = state->memregion("sprites")->base();
-	int code_max = state->memregion("sprites")->bytes() / (16*16);
+	int code_max = state->memregion("sprites")->bytes() / ((16*16) >> state->m_sprite_packed);
 
 	UINT16 *source;
 	UINT16 *finish;
@@ -677,7 +677,7 @@ static void get_sprite_info_donpachi( running_machine &machine )
 
 		/* Bound checking */
 		code %= code_max;
-		sprite->pen_data = base_gfx + (16*16) * code;
+		sprite->pen_data = base_gfx + ((16*16) >> state->m_sprite_packed) * code;
 
 		if (x > 0x1ff)  x -= 0x400;
 		if (y > 0x1ff)  y -= 0x400;
@@ -701,7 +701,7 @@ static void get_sprite_info_donpachi( running_machine &machine )
 		}
 
 		sprite->flags = SPRITE_VISIBLE_CAVE;
-		sprite->line_offset = sprite->tile_width;
+		sprite->line_offset = sprite->tile_width >> state->m_sprite_packed;
 
 		if (glob_flipx) { x = max_x - x - sprite->total_width;  flipx = !flipx; }
 		if (glob_flipy) { y = max_y - y - sprite->total_height; flipy = !flipy; }
@@ -834,6 +834,15 @@ static void cave_sprite_check( screen_device &screen, const rectangle &clip )
 	}
 }
 
+/* fetch pen x of a sprite row: either one pen per byte, or two per byte
+   with the even pixel in the low nibble */
+INLINE UINT8 sprite_pen_cave( const UINT8 *row, int x, int packed )
+{
+	if (packed)
+		return (row[x >> 1] >> ((x & 1) << 2)) & 0x0f;
+	return row[x];
+}
+
 static void do_blit_zoom16_cave( running_machine &machine, const struct sprite_cave *sprite )
 {
 	/*  assumes SPRITE_LIST_RAW_DATA flag is set */
@@ -928,7 +937,8 @@ static void do_blit_zoom16_cave( running_machine &machine, const struct sprite_c
 	}
 
 	{
-		const UINT8 *pen_data = sprite->pen_data -1 -sprite->line_offset;
+		const UINT8 *pen_data = sprite->pen_data - sprite->line_offset;
+		int packed = state->m_sprite_packed;
 		pen_t base_pen = sprite->base_pen;
 		int x, y;
 		UINT8 pen;
@@ -938,22 +948,21 @@ static void do_blit_zoom16_cave( running_machine &machine, const struct sprite_c
 
 		for (y = y1; y != y2; y += dy)
 		{
-			int xcount;
-			const UINT8 *source;
+			int xcount, srcx;
 
 			if (ycount & 0xffff0000)
 			{
 				xcount = xcount0;
 				pen_data += sprite->line_offset * (ycount >> 16);
 				ycount &= 0xffff;
-				source = pen_data;
+				srcx = -1;
 				for (x = x1; x != x2; x += dx)
 				{
 					if (xcount & 0xffff0000)
 					{
-						source += xcount >> 16;
+						srcx += xcount >> 16;
 						xcount &= 0xffff;
-						pen = *source;
+						pen = sprite_pen_cave(pen_data, srcx, packed);
 						if (pen)
 							dest[x] = base_pen + pen;
 					}
@@ -1058,7 +1067,8 @@ static void do_blit_zoom16_cave_zb( running_machine &machine, const struct sprit
 	}
 
 	{
-		const UINT8 *pen_data = sprite->pen_data - 1 - sprite->line_offset;
+		const UINT8 *pen_data = sprite->pen_data - sprite->line_offset;
+		int packed = state->m_sprite_packed;
 		pen_t base_pen = sprite->base_pen;
 		int x, y;
 		UINT8 pen;
@@ -1071,22 +1081,21 @@ static void do_blit_zoom16_cave_zb( running_machine &machine, const struct sprit
 
 		for (y = y1; y != y2; y += dy)
 		{
-			int xcount;
-			const UINT8 *source;
+			int xcount, srcx;
 
 			if (ycount & 0xffff0000)
 			{
 				xcount = xcount0;
 				pen_data += sprite->line_offset * (ycount >> 16);
 				ycount &= 0xffff;
-				source = pen_data;
+				srcx = -1;
 				for (x = x1; x != x2; x += dx)
 				{
 					if (xcount & 0xffff0000)
 					{
-						source += xcount >> 16;
+						srcx += xcount >> 16;
 						xcount &= 0xffff;
-						pen = *source;
+						pen = sprite_pen_cave(pen_data, srcx, packed);
 						if (pen && (zbf[x] <= pri_sp))
 						{
 							dest[x] = base_pen + pen;
@@ -1174,23 +1183,23 @@ static void do_blit_16_cave( running_machine &machine, const struct sprite_cave
 
 	{
 		const UINT8 *pen_data = sprite->pen_data;
+		int packed = state->m_sprite_packed;
 		pen_t base_pen = sprite->base_pen;
 		int x, y;
 		UINT8 pen;
 		int pitch = state->m_blit.line_offset * dy / 2;
 		UINT16 *dest = (UINT16 *)(state->m_blit.baseaddr + state->m_blit.line_offset * y1);
 
-		pen_data += sprite->line_offset * ycount0 + xcount0;
+		pen_data += sprite->line_offset * ycount0;
 		for (y = y1; y != y2; y += dy)
 		{
-			const UINT8 *source;
-			source = pen_data;
+			int srcx = xcount0;
 			for (x = x1; x != x2; x += dx)
 			{
-				pen = *source;
+				pen = sprite_pen_cave(pen_data, srcx, packed);
 				if (pen)
 					dest[x] = base_pen + pen;
-				source++;
+				srcx++;
 			}
 			pen_data += sprite->line_offset;
 			dest += pitch;
@@ -1271,6 +1280,7 @@ static void do_blit_16_cave_zb( running_machine &machine,  const struct sprite_c
 
 	{
 		const UINT8 *pen_data = sprite->pen_data;
+		int packed = state->m_sprite_packed;
 		pen_t base_pen = sprite->base_pen;
 		int x, y;
 		UINT8 pen;
@@ -1280,20 +1290,19 @@ static void do_blit_16_cave_zb( running_machine &machine,  const struct sprite_c
 		UINT16 *zbf = (UINT16 *)(state->m_blit.baseaddr_zbuf + state->m_blit.line_offset_zbuf * y1);
 		UINT16 pri_sp = (UINT16)(sprite - state->m_sprite) + state->m_sprite_zbuf_baseval;
 
-		pen_data += sprite->line_offset * ycount0 + xcount0;
+		pen_data += sprite->line_offset * ycount0;
 		for (y = y1; y != y2; y += dy)
 		{
-			const UINT8 *source;
-			source = pen_data;
+			int srcx = xcount0;
 			for (x = x1; x != x2; x += dx)
 			{
-				pen = *source;
+				pen = sprite_pen_cave(pen_data, srcx, packed);
 				if (pen && (zbf[x] <= pri_sp))
 				{
 					dest[x] = base_pen + pen;
 					zbf[x] = pri_sp;
 				}
-				source++;
+				srcx++;
 			}
 			pen_data += sprite->line_offset;
 			dest += pitch;
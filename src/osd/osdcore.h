@@ -210,6 +210,28 @@ file_error osd_write(osd_file *file, const void *buffer, UINT64 offset, UINT32 l
 file_error osd_rmfile(const char *filename);
 
 
+/*-----------------------------------------------------------------------------
+    osd_rename: renames a file, replacing any existing file of the new name
+
+    Parameters:
+
+        oldname - path to the file to rename
+
+        newname - path the file should have afterwards
+
+    Return value:
+
+        a file_error describing any error that occurred while renaming
+        the file, or FILERR_NONE if no error occurred
+
+    Notes:
+
+        Where the system allows it the replacement is atomic: anyone
+        opening newname sees either the old file or the complete new one.
+-----------------------------------------------------------------------------*/
+file_error osd_rename(const char *oldname, const char *newname);
+
+
 /*-----------------------------------------------------------------------------
     osd_get_physical_drive_geometry: if the given path points to a physical
         drive, return the geometry of that drive
@@ -809,6 +831,46 @@ void *osd_alloc_executable(size_t size);
 void osd_free_executable(void *ptr, size_t size);
 
 
+/*-----------------------------------------------------------------------------
+    osd_map_file_private: map an entire file into memory copy-on-write
+
+    Parameters:
+
+        path - the path of the file to map
+
+        length - pointer to a UINT64 to receive the length of the mapping
+
+    Return value:
+
+        a pointer to the mapped data, or NULL if the file could not be
+        mapped
+
+    Notes:
+
+        Pages that are never written stay backed by the file, so every
+        process mapping the same file shares their physical memory. Writes
+        go to a private copy of the page and never reach the file. Systems
+        without file mapping support may simply return NULL.
+-----------------------------------------------------------------------------*/
+void *osd_map_file_private(const char *path, UINT64 *length);
+
+
+/*-----------------------------------------------------------------------------
+    osd_unmap_file: release a mapping made by osd_map_file_private
+
+    Parameters:
+
+        ptr - the pointer returned from osd_map_file_private
+
+        length - the length returned from osd_map_file_private
+
+    Return value:
+
+        None
+-----------------------------------------------------------------------------*/
+void osd_unmap_file(void *ptr, UINT64 length);
+
+
 /*-----------------------------------------------------------------------------
     osd_break_into_debugger: break into the hosting system's debugger if one
         is attached
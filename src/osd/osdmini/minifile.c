@@ -144,6 +144,16 @@ file_error osd_rmfile(const char *filename)
 }
 
 
+//============================================================
+//  osd_rename
+//============================================================
+
+file_error osd_rename(const char *oldname, const char *newname)
+{
+	return rename(oldname, newname) ? FILERR_FAILURE : FILERR_NONE;
+}
+
+
 //============================================================
 //  osd_get_physical_drive_geometry
 //============================================================
@@ -95,6 +95,26 @@ void osd_free_executable(void *ptr, size_t size)
 }
 
 
+//============================================================
+//  osd_map_file_private
+//============================================================
+
+void *osd_map_file_private(const char *path, UINT64 *length)
+{
+	// file mapping isn't supported; callers fall back to private memory
+	return NULL;
+}
+
+
+//============================================================
+//  osd_unmap_file
+//============================================================
+
+void osd_unmap_file(void *ptr, UINT64 length)
+{
+}
+
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
@@ -401,6 +401,20 @@ file_error osd_rmfile(const char *filename)
 	return FILERR_NONE;
 }
 
+//============================================================
+//  osd_rename
+//============================================================
+
+file_error osd_rename(const char *oldname, const char *newname)
+{
+	if (rename(oldname, newname) == -1)
+	{
+		return error_to_file_error(errno);
+	}
+
+	return FILERR_NONE;
+}
+
 //============================================================
 //  create_path_recursive
 //============================================================
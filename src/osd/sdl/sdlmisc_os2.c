@@ -49,6 +49,25 @@ void osd_free_executable(void *ptr, size_t size)
 	DosFreeMem( ptr );
 }
 
+//============================================================
+//  osd_map_file_private
+//
+//  not supported; callers fall back to private memory
+//============================================================
+
+void *osd_map_file_private(const char *path, UINT64 *length)
+{
+	return NULL;
+}
+
+//============================================================
+//  osd_unmap_file
+//============================================================
+
+void osd_unmap_file(void *ptr, UINT64 length)
+{
+}
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
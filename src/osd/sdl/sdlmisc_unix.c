@@ -10,6 +10,9 @@
 //============================================================
 
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <signal.h>
 #ifdef MAME_DEBUG
 #include <unistd.h>
@@ -50,6 +53,53 @@ void osd_free_executable(void *ptr, size_t size)
 #endif
 }
 
+//============================================================
+//  osd_map_file_private
+//
+//  maps a whole file copy-on-write
+//============================================================
+
+void *osd_map_file_private(const char *path, UINT64 *length)
+{
+	struct stat st;
+	void *ptr;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return NULL;
+
+	if (fstat(fd, &st) != 0 || st.st_size == 0)
+	{
+		close(fd);
+		return NULL;
+	}
+
+	// the mapping stays valid after the descriptor is closed
+	ptr = mmap(0, st.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (ptr == MAP_FAILED)
+		return NULL;
+
+	*length = st.st_size;
+	return ptr;
+}
+
+//============================================================
+//  osd_unmap_file
+//
+//  releases a mapping made by osd_map_file_private
+//============================================================
+
+void osd_unmap_file(void *ptr, UINT64 length)
+{
+#ifdef SDLMAME_SOLARIS
+	munmap((char *)ptr, length);
+#else
+	munmap(ptr, length);
+#endif
+}
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
@@ -43,6 +43,24 @@ enum
 #endif
 #define MAX_SCALE_BANK				(MAX_SCREENS * 2)
 
+/* row bands rendered in parallel by the line based effects */
+#define MAX_SCALE_BANDS				8
+#define SCALE_MIN_BAND_ROWS			16
+
+struct scale_band
+{
+	int effect;
+	UINT8 *src;
+	UINT8 *dst;
+	int src_pitch;
+	int dst_pitch;
+	int width;
+	int height;
+	int depth;
+	int y0;
+	int y1;
+};
+
 
 //============================================================
 //	GLOBAL VARIABLES
@@ -71,6 +89,9 @@ static int previous_depth[MAX_SCALE_BANK];
 static int previous_width[MAX_SCALE_BANK];
 static int previous_height[MAX_SCALE_BANK];
 
+static osd_work_queue *scale_queue;
+static scale_band scale_bands[MAX_SCALE_BANDS];
+
 static const char *str_name[] =
 {
 	"none",
@@ -125,6 +146,7 @@ static void (*scale_scale2x_line_16)(UINT16 *dst0, UINT16 *dst1, const UINT16 *s
 static void (*scale_scale2x_line_32)(UINT32 *dst0, UINT32 *dst1, const UINT32 *src0, const UINT32 *src1, const UINT32 *src2, unsigned count);
 
 static int scale_perform_scale3x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth);
+static void (*scale_scale3x_line_32)(UINT32 *dst0, UINT32 *dst1, UINT32 *dst2, const UINT32 *src0, const UINT32 *src1, const UINT32 *src2, unsigned count);
 
 // functions from AdvMAME
 void scale2x_16_def(UINT16* dst0, UINT16* dst1, const UINT16* src0, const UINT16* src1, const UINT16* src2, unsigned count);
@@ -133,9 +155,15 @@ void scale2x_32_def(UINT32* dst0, UINT32* dst1, const UINT32* src0, const UINT32
 void scale2x_16_mmx(UINT16* dst0, UINT16* dst1, const UINT16* src0, const UINT16* src1, const UINT16* src2, unsigned count);
 void scale2x_32_mmx(UINT32* dst0, UINT32* dst1, const UINT32* src0, const UINT32* src1, const UINT32* src2, unsigned count);
 #endif /* USE_MMX_INTERP_SCALE */
+#ifdef USE_SSE2_INTERP_SCALE
+void scale2x_32_sse2(UINT32* dst0, UINT32* dst1, const UINT32* src0, const UINT32* src1, const UINT32* src2, unsigned count);
+#endif /* USE_SSE2_INTERP_SCALE */
 
 void scale3x_16_def(UINT16* dst0, UINT16* dst1, UINT16* dst2, const UINT16* src0, const UINT16* src1, const UINT16* src2, unsigned count);
 void scale3x_32_def(UINT32* dst0, UINT32* dst1, UINT32* dst2, const UINT32* src0, const UINT32* src1, const UINT32* src2, unsigned count);
+#ifdef USE_SSE2_INTERP_SCALE
+void scale3x_32_sse2(UINT32* dst0, UINT32* dst1, UINT32* dst2, const UINT32* src0, const UINT32* src1, const UINT32* src2, unsigned count);
+#endif /* USE_SSE2_INTERP_SCALE */
 
 void hq2x_32_def(UINT32*, UINT32*, const UINT32*, const UINT32*, const UINT32*, unsigned);
 void hq3x_32_def(UINT32*, UINT32*, UINT32*, const UINT32*, const UINT32*, const UINT32*, unsigned);
@@ -285,6 +313,12 @@ int scale_exit(void)
 		}
 	}
 
+	if (scale_queue)
+	{
+		osd_work_queue_free(scale_queue);
+		scale_queue = NULL;
+	}
+
 	return 0;
 }
 
@@ -340,6 +374,9 @@ int scale_init(void)
 
 	scale_exit();
 
+	// scale2x/scale3x/hq2x/hq3x split the frame into row bands on this queue
+	scale_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
 	scale_effect.xsize = scale_effect.ysize = 1;
 	sprintf(name, "none");
 	scale_effect.name = name;
@@ -368,14 +405,22 @@ int scale_init(void)
 
 		case SCALE_EFFECT_SCALE2X:
 		{
+#ifdef USE_SSE2_INTERP_SCALE
+			sprintf(name, "Scale2x (sse2 optimised)");
+#else
 			sprintf(name, "Scale2x (%s)", use_mmx ? "mmx optimised" : "non-mmx version");
+#endif /* USE_SSE2_INTERP_SCALE */
 			scale_effect.xsize = scale_effect.ysize = 2;
 			break;
 		}
 
 		case SCALE_EFFECT_SCALE3X:
 		{
+#ifdef USE_SSE2_INTERP_SCALE
+			sprintf(name, "Scale3x (sse2 optimised)");
+#else
 			sprintf(name, "Scale3x (non-mmx version)");
+#endif /* USE_SSE2_INTERP_SCALE */
 			scale_effect.xsize = scale_effect.ysize = 3;
 			break;
 		}
@@ -635,15 +680,124 @@ INLINE void scale_emms(void)
 
 
 //============================================================
-//	scale_perform_scale2x
+//	scale_render_rows
 //============================================================
-static int scale_perform_scale2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth, int bank)
+
+static void scale_render_rows(const scale_band *band)
 {
 	int y;
-	UINT8 *src_prev = src;
-	UINT8 *src_curr = src;
-	UINT8 *src_next = src + src_pitch;
 
+	for (y = band->y0; y < band->y1; y++)
+	{
+		UINT8 *src_curr = band->src + y * band->src_pitch;
+		UINT8 *src_prev = (y > 0) ? src_curr - band->src_pitch : src_curr;
+		UINT8 *src_next = (y < band->height - 1) ? src_curr + band->src_pitch : src_curr;
+		UINT8 *dst;
+
+		switch (band->effect)
+		{
+			case SCALE_EFFECT_SCALE2X:
+				dst = band->dst + 2 * y * band->dst_pitch;
+				if (band->depth == 15 || band->depth == 16)
+				{
+					if (y == 0)
+						scale2x_16_def((UINT16 *)dst, (UINT16 *)(dst + band->dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, band->width);
+					else
+						scale_scale2x_line_16((UINT16 *)dst, (UINT16 *)(dst + band->dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, band->width);
+				}
+				else
+				{
+					if (y == 0)
+						scale2x_32_def((UINT32 *)dst, (UINT32 *)(dst + band->dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, band->width);
+					else
+						scale_scale2x_line_32((UINT32 *)dst, (UINT32 *)(dst + band->dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, band->width);
+				}
+				break;
+
+			case SCALE_EFFECT_SCALE3X:
+				dst = band->dst + 3 * y * band->dst_pitch;
+				if (band->depth == 15 || band->depth == 16)
+					scale3x_16_def((UINT16 *)dst, (UINT16 *)(dst + band->dst_pitch), (UINT16 *)(dst + 2 * band->dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, band->width);
+				else
+					scale_scale3x_line_32((UINT32 *)dst, (UINT32 *)(dst + band->dst_pitch), (UINT32 *)(dst + 2 * band->dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, band->width);
+				break;
+
+			case SCALE_EFFECT_HQ2X:
+				dst = band->dst + 2 * y * band->dst_pitch;
+				hq2x_32_def((UINT32 *)dst, (UINT32 *)(dst + band->dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, band->width);
+				break;
+
+			case SCALE_EFFECT_HQ3X:
+				dst = band->dst + 3 * y * band->dst_pitch;
+				hq3x_32_def((UINT32 *)dst, (UINT32 *)(dst + band->dst_pitch), (UINT32 *)(dst + 2 * band->dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, band->width);
+				break;
+		}
+	}
+}
+
+
+//============================================================
+//	scale_band_callback
+//============================================================
+
+static void *scale_band_callback(void *param, int threadid)
+{
+	scale_render_rows((const scale_band *)param);
+
+	// MMX state must be cleared on the thread that used it
+	scale_emms();
+	return NULL;
+}
+
+
+//============================================================
+//	scale_perform_bands
+//============================================================
+
+static void scale_perform_bands(int effect, UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth)
+{
+	int numbands = height / SCALE_MIN_BAND_ROWS;
+	int bandnum;
+
+	if (numbands > MAX_SCALE_BANDS)
+		numbands = MAX_SCALE_BANDS;
+	if (numbands < 1 || scale_queue == NULL)
+		numbands = 1;
+
+	// rows only read their neighbours from the source, so bands are independent
+	for (bandnum = 0; bandnum < numbands; bandnum++)
+	{
+		scale_band *band = &scale_bands[bandnum];
+
+		band->effect = effect;
+		band->src = src;
+		band->dst = dst;
+		band->src_pitch = src_pitch;
+		band->dst_pitch = dst_pitch;
+		band->width = width;
+		band->height = height;
+		band->depth = depth;
+		band->y0 = height * bandnum / numbands;
+		band->y1 = height * (bandnum + 1) / numbands;
+	}
+
+	if (numbands == 1)
+	{
+		scale_band_callback(&scale_bands[0], 0);
+		return;
+	}
+
+	osd_work_item_queue_multiple(scale_queue, scale_band_callback, numbands, scale_bands, sizeof(scale_bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(scale_queue, 100 * osd_ticks_per_second());
+}
+
+
+//============================================================
+//	scale_perform_scale2x
+//============================================================
+
+static int scale_perform_scale2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth, int bank)
+{
 	if (depth != 15 && depth != 16 && depth != 32)
 		return 1;
 
@@ -662,48 +816,14 @@ static int scale_perform_scale2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_
 			scale_scale2x_line_32 = scale2x_32_def;
 		}
 
-		previous_depth[bank] = depth;
-	}
-
-	if (depth == 15 || depth == 16)
-//		scale_scale2x_line_16((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-		scale2x_16_def((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-	else
-//		scale_scale2x_line_32((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-		scale2x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
+#ifdef USE_SSE2_INTERP_SCALE
+		scale_scale2x_line_32 = scale2x_32_sse2;
+#endif /* USE_SSE2_INTERP_SCALE */
 
-	if (depth == 15 || depth == 16)
-	{
-		for (y = 2; y < height; y++)
-		{
-			dst += 2 * dst_pitch;
-			src_prev = src_curr;
-			src_curr = src_next;
-			src_next += src_pitch;
-			scale_scale2x_line_16((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-		}
-	}
-	else
-	{
-		for (y = 2; y < height; y++)
-		{
-			dst += 2 * dst_pitch;
-			src_prev = src_curr;
-			src_curr = src_next;
-			src_next += src_pitch;
-			scale_scale2x_line_32((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-		}
+		previous_depth[bank] = depth;
 	}
 
-	dst += 2 * dst_pitch;
-	src_prev = src_curr;
-	src_curr = src_next;
-	if (depth == 15 || depth == 16)
-		scale_scale2x_line_16((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-	else
-		scale_scale2x_line_32((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-
-	scale_emms();
+	scale_perform_bands(SCALE_EFFECT_SCALE2X, src, dst, src_pitch, dst_pitch, width, height, depth);
 
 	return 0;
 }
@@ -714,49 +834,16 @@ static int scale_perform_scale2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_
 
 static int scale_perform_scale3x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth)
 {
-	int y;
-	UINT8 *src_prev = src;
-	UINT8 *src_curr = src;
-	UINT8 *src_next = src + src_pitch;
-
 	if (depth != 15 && depth != 16 && depth != 32)
 		return 1;
 
-	if (depth == 15 || depth == 16)
-		scale3x_16_def((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)(dst + 2 * dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-	else
-		scale3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-
-	if (depth == 15 || depth == 16)
-	{
-		for (y = 2; y < height; y++)
-		{
-			dst	+= 3 * dst_pitch;
-			src_prev = src_curr;
-			src_curr = src_next;
-			src_next += src_pitch;
-			scale3x_16_def((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)(dst + 2 * dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-		}
-	}
-	else
-	{
-		for (y = 2; y < height; y++)
-		{
-			dst += 3 * dst_pitch;
-			src_prev = src_curr;
-			src_curr = src_next;
-			src_next += src_pitch;
-			scale3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-		}
-	}
+#ifdef USE_SSE2_INTERP_SCALE
+	scale_scale3x_line_32 = scale3x_32_sse2;
+#else
+	scale_scale3x_line_32 = scale3x_32_def;
+#endif /* USE_SSE2_INTERP_SCALE */
 
-	dst += 3 * dst_pitch;
-	src_prev = src_curr;
-	src_curr = src_next;
-	if (depth == 15 || depth == 16)
-		scale3x_16_def((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)(dst + 2 * dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-	else
-		scale3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
+	scale_perform_bands(SCALE_EFFECT_SCALE3X, src, dst, src_pitch, dst_pitch, width, height, depth);
 
 	return 0;
 }
@@ -767,30 +854,10 @@ static int scale_perform_scale3x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_
 
 static int scale_perform_hq2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth)
 {
-	int y;
-	UINT8 *src_prev = src;
-	UINT8 *src_curr = src;
-	UINT8 *src_next = src + src_pitch;
-
+	// the lookup tables are shared by every band, so build them up front
 	interp_init();
 
-	hq2x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-
-	for (y = 2; y < height; y++)
-	{
-		dst += 2 * dst_pitch;
-		src_prev = src_curr;
-		src_curr = src_next;
-		src_next += src_pitch;
-
-		hq2x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-	}
-
-	dst += 2 * dst_pitch;
-	src_prev = src_curr;
-	src_curr = src_next;
-
-	hq2x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
+	scale_perform_bands(SCALE_EFFECT_HQ2X, src, dst, src_pitch, dst_pitch, width, height, depth);
 
 	return 0;
 }
@@ -801,30 +868,9 @@ static int scale_perform_hq2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pit
 
 static int scale_perform_hq3x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth)
 {
-	int y;
-	UINT8 *src_prev = src;
-	UINT8 *src_curr = src;
-	UINT8 *src_next = src + src_pitch;
-
 	interp_init();
-	
-	hq3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-
-	for (y = 2; y < height; y++)
-	{
-		dst += 3 * dst_pitch;
-		src_prev = src_curr;
-		src_curr = src_next;
-		src_next += src_pitch;
-
-		hq3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-	}
-
-	dst += 3 * dst_pitch;
-	src_prev = src_curr;
-	src_curr = src_next;
 
-	hq3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
+	scale_perform_bands(SCALE_EFFECT_HQ3X, src, dst, src_pitch, dst_pitch, width, height, depth);
 
 	return 0;
 }
@@ -31,6 +31,18 @@ ifneq ($(PTR64),1)
 DEFS += -DUSE_MMX_INTERP_SCALE
 endif
 
+# SSE2 is always present on 64-bit targets; 32-bit builds can opt in with SSE2=1
+ifeq ($(PTR64),1)
+DEFS += -DUSE_SSE2_INTERP_SCALE
+else
+ifdef SSE2
+DEFS += -DUSE_SSE2_INTERP_SCALE
+ifndef MSVC_BUILD
+CCOMFLAGS += -msse2
+endif
+endif
+endif
+
 
 
 #-------------------------------------------------
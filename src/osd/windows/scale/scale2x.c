@@ -32,6 +32,10 @@
  * - derivative works of the program are allowed.
  */
 
+#ifdef USE_SSE2_INTERP_SCALE
+#include <emmintrin.h>
+#endif
+
 #include "port.h"
 
 #include <assert.h>
@@ -1848,3 +1852,89 @@ void scale2x4_32_mmx(scale2x_uint32* dst0, scale2x_uint32* dst1, scale2x_uint32*
 #endif
 
 #endif /* USE_MMX_INTERP_SCALE */
+
+/***************************************************************************/
+/* Scale2x SSE2 implementation */
+
+#ifdef USE_SSE2_INTERP_SCALE
+
+/*
+ * Select "a" where mask is set, "b" elsewhere.
+ */
+INLINE __m128i scale2x_sse2_select(__m128i mask, __m128i a, __m128i b)
+{
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+INLINE void scale2x_32_sse2_border(scale2x_uint32* restrict dst, const scale2x_uint32* restrict src0, const scale2x_uint32* restrict src1, const scale2x_uint32* restrict src2, unsigned count)
+{
+	unsigned i;
+
+	assert(count >= 2);
+
+	/* first pixel */
+	if (src0[0] != src2[0] && src1[0] != src1[1]) {
+		dst[0] = src1[0] == src0[0] ? src0[0] : src1[0];
+		dst[1] = src1[1] == src0[0] ? src0[0] : src1[0];
+	} else {
+		dst[0] = src1[0];
+		dst[1] = src1[0];
+	}
+
+	/* central pixels, four at a time */
+	for (i = 1; i + 4 < count; i += 4) {
+		__m128i B = _mm_loadu_si128((const __m128i *)(src0 + i));
+		__m128i H = _mm_loadu_si128((const __m128i *)(src2 + i));
+		__m128i D = _mm_loadu_si128((const __m128i *)(src1 + i - 1));
+		__m128i E = _mm_loadu_si128((const __m128i *)(src1 + i));
+		__m128i F = _mm_loadu_si128((const __m128i *)(src1 + i + 1));
+		__m128i skip = _mm_or_si128(_mm_cmpeq_epi32(B, H), _mm_cmpeq_epi32(D, F));
+		__m128i e0 = scale2x_sse2_select(_mm_andnot_si128(skip, _mm_cmpeq_epi32(D, B)), B, E);
+		__m128i e1 = scale2x_sse2_select(_mm_andnot_si128(skip, _mm_cmpeq_epi32(F, B)), B, E);
+
+		_mm_storeu_si128((__m128i *)(dst + 2 * i), _mm_unpacklo_epi32(e0, e1));
+		_mm_storeu_si128((__m128i *)(dst + 2 * i + 4), _mm_unpackhi_epi32(e0, e1));
+	}
+
+	/* remaining central pixels */
+	for (; i < count - 1; ++i) {
+		if (src0[i] != src2[i] && src1[i - 1] != src1[i + 1]) {
+			dst[2 * i] = src1[i - 1] == src0[i] ? src0[i] : src1[i];
+			dst[2 * i + 1] = src1[i + 1] == src0[i] ? src0[i] : src1[i];
+		} else {
+			dst[2 * i] = src1[i];
+			dst[2 * i + 1] = src1[i];
+		}
+	}
+
+	/* last pixel */
+	if (src0[i] != src2[i] && src1[i - 1] != src1[i]) {
+		dst[2 * i] = src1[i - 1] == src0[i] ? src0[i] : src1[i];
+		dst[2 * i + 1] = src1[i] == src0[i] ? src0[i] : src1[i];
+	} else {
+		dst[2 * i] = src1[i];
+		dst[2 * i + 1] = src1[i];
+	}
+}
+
+/**
+ * Scale by a factor of 2 a row of pixels of 32 bits.
+ * This function operates like scale2x_32_def() but processes four source
+ * pixels per iteration with SSE2 compares and selects. The output is
+ * identical to the C version; unlike the MMX version there is no
+ * restriction on count other than being at least 2, and no EMMS is needed.
+ * \param src0 Pointer at the first pixel of the previous row.
+ * \param src1 Pointer at the first pixel of the current row.
+ * \param src2 Pointer at the first pixel of the next row.
+ * \param count Length in pixels of the src0, src1 and src2 rows.
+ * It must be at least 2.
+ * \param dst0 First destination row, double length in pixels.
+ * \param dst1 Second destination row, double length in pixels.
+ */
+void scale2x_32_sse2(scale2x_uint32* dst0, scale2x_uint32* dst1, const scale2x_uint32* src0, const scale2x_uint32* src1, const scale2x_uint32* src2, unsigned count)
+{
+	scale2x_32_sse2_border(dst0, src0, src1, src2, count);
+	scale2x_32_sse2_border(dst1, src2, src1, src0, count);
+}
+
+#endif /* USE_SSE2_INTERP_SCALE */
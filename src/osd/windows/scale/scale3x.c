@@ -32,6 +32,10 @@
  * - derivative works of the program are allowed.
  */
 
+#ifdef USE_SSE2_INTERP_SCALE
+#include <emmintrin.h>
+#endif
+
 #include "port.h"
 
 #include <assert.h>
@@ -697,3 +701,181 @@ void scale3x_32_def(scale3x_uint32* dst0, scale3x_uint32* dst1, scale3x_uint32*
 	scale3x_32_def_border(dst2, src2, src1, src0, count);
 #endif
 }
+
+/***************************************************************************/
+/* Scale3x SSE2 implementation */
+
+#ifdef USE_SSE2_INTERP_SCALE
+
+/*
+ * Select "a" where mask is set, "b" elsewhere.
+ */
+INLINE __m128i scale3x_sse2_select(__m128i mask, __m128i a, __m128i b)
+{
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/*
+ * Store four triplets a[n] b[n] c[n] as 12 consecutive pixels.
+ */
+INLINE void scale3x_sse2_store3(scale3x_uint32* dst, __m128i a, __m128i b, __m128i c)
+{
+	__m128 ab_lo = _mm_castsi128_ps(_mm_unpacklo_epi32(a, b));
+	__m128 ab_hi = _mm_castsi128_ps(_mm_unpackhi_epi32(a, b));
+	__m128 bc_lo = _mm_castsi128_ps(_mm_unpacklo_epi32(b, c));
+	__m128 bc_hi = _mm_castsi128_ps(_mm_unpackhi_epi32(b, c));
+	__m128 ca_lo = _mm_castsi128_ps(_mm_unpacklo_epi32(c, a));
+	__m128 ca_hi = _mm_castsi128_ps(_mm_unpackhi_epi32(c, a));
+
+	_mm_storeu_ps((float *)dst + 0, _mm_shuffle_ps(ab_lo, ca_lo, _MM_SHUFFLE(3, 0, 1, 0)));
+	_mm_storeu_ps((float *)dst + 4, _mm_shuffle_ps(bc_lo, ab_hi, _MM_SHUFFLE(1, 0, 3, 2)));
+	_mm_storeu_ps((float *)dst + 8, _mm_shuffle_ps(ca_hi, bc_hi, _MM_SHUFFLE(3, 2, 3, 0)));
+}
+
+INLINE void scale3x_32_sse2_border(scale3x_uint32* restrict dst, const scale3x_uint32* restrict src0, const scale3x_uint32* restrict src1, const scale3x_uint32* restrict src2, unsigned count)
+{
+	unsigned i;
+
+	assert(count >= 2);
+
+	/* first pixel */
+	if (src0[0] != src2[0] && src1[0] != src1[1]) {
+		dst[0] = src1[0];
+		dst[1] = (src1[0] == src0[0] && src1[0] != src0[1]) || (src1[1] == src0[0] && src1[0] != src0[0]) ? src0[0] : src1[0];
+		dst[2] = src1[1] == src0[0] ? src1[1] : src1[0];
+	} else {
+		dst[0] = src1[0];
+		dst[1] = src1[0];
+		dst[2] = src1[0];
+	}
+
+	/* central pixels, four at a time */
+	for (i = 1; i + 4 < count; i += 4) {
+		__m128i A = _mm_loadu_si128((const __m128i *)(src0 + i - 1));
+		__m128i B = _mm_loadu_si128((const __m128i *)(src0 + i));
+		__m128i C = _mm_loadu_si128((const __m128i *)(src0 + i + 1));
+		__m128i D = _mm_loadu_si128((const __m128i *)(src1 + i - 1));
+		__m128i E = _mm_loadu_si128((const __m128i *)(src1 + i));
+		__m128i F = _mm_loadu_si128((const __m128i *)(src1 + i + 1));
+		__m128i H = _mm_loadu_si128((const __m128i *)(src2 + i));
+		__m128i skip = _mm_or_si128(_mm_cmpeq_epi32(B, H), _mm_cmpeq_epi32(D, F));
+		__m128i DB = _mm_cmpeq_epi32(D, B);
+		__m128i FB = _mm_cmpeq_epi32(F, B);
+		__m128i m1 = _mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi32(E, C), DB), _mm_andnot_si128(_mm_cmpeq_epi32(E, A), FB));
+
+		scale3x_sse2_store3(dst + 3 * i,
+			scale3x_sse2_select(_mm_andnot_si128(skip, DB), D, E),
+			scale3x_sse2_select(_mm_andnot_si128(skip, m1), B, E),
+			scale3x_sse2_select(_mm_andnot_si128(skip, FB), F, E));
+	}
+
+	/* remaining central pixels */
+	for (; i < count - 1; ++i) {
+		if (src0[i] != src2[i] && src1[i - 1] != src1[i + 1]) {
+			dst[3 * i] = src1[i - 1] == src0[i] ? src1[i - 1] : src1[i];
+			dst[3 * i + 1] = (src1[i - 1] == src0[i] && src1[i] != src0[i + 1]) || (src1[i + 1] == src0[i] && src1[i] != src0[i - 1]) ? src0[i] : src1[i];
+			dst[3 * i + 2] = src1[i + 1] == src0[i] ? src1[i + 1] : src1[i];
+		} else {
+			dst[3 * i] = src1[i];
+			dst[3 * i + 1] = src1[i];
+			dst[3 * i + 2] = src1[i];
+		}
+	}
+
+	/* last pixel */
+	if (src0[i] != src2[i] && src1[i - 1] != src1[i]) {
+		dst[3 * i] = src1[i - 1] == src0[i] ? src1[i - 1] : src1[i];
+		dst[3 * i + 1] = (src1[i - 1] == src0[i] && src1[i] != src0[i]) || (src1[i] == src0[i] && src1[i] != src0[i - 1]) ? src0[i] : src1[i];
+		dst[3 * i + 2] = src1[i];
+	} else {
+		dst[3 * i] = src1[i];
+		dst[3 * i + 1] = src1[i];
+		dst[3 * i + 2] = src1[i];
+	}
+}
+
+INLINE void scale3x_32_sse2_center(scale3x_uint32* restrict dst, const scale3x_uint32* restrict src0, const scale3x_uint32* restrict src1, const scale3x_uint32* restrict src2, unsigned count)
+{
+	unsigned i;
+
+	assert(count >= 2);
+
+	/* first pixel */
+	if (src0[0] != src2[0] && src1[0] != src1[1]) {
+		dst[0] = src1[0];
+		dst[1] = src1[0];
+		dst[2] = (src1[1] == src0[0] && src1[0] != src2[1]) || (src1[1] == src2[0] && src1[0] != src0[1]) ? src1[1] : src1[0];
+	} else {
+		dst[0] = src1[0];
+		dst[1] = src1[0];
+		dst[2] = src1[0];
+	}
+
+	/* central pixels, four at a time */
+	for (i = 1; i + 4 < count; i += 4) {
+		__m128i A = _mm_loadu_si128((const __m128i *)(src0 + i - 1));
+		__m128i B = _mm_loadu_si128((const __m128i *)(src0 + i));
+		__m128i C = _mm_loadu_si128((const __m128i *)(src0 + i + 1));
+		__m128i D = _mm_loadu_si128((const __m128i *)(src1 + i - 1));
+		__m128i E = _mm_loadu_si128((const __m128i *)(src1 + i));
+		__m128i F = _mm_loadu_si128((const __m128i *)(src1 + i + 1));
+		__m128i G = _mm_loadu_si128((const __m128i *)(src2 + i - 1));
+		__m128i H = _mm_loadu_si128((const __m128i *)(src2 + i));
+		__m128i I = _mm_loadu_si128((const __m128i *)(src2 + i + 1));
+		__m128i skip = _mm_or_si128(_mm_cmpeq_epi32(B, H), _mm_cmpeq_epi32(D, F));
+		__m128i m0 = _mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi32(E, G), _mm_cmpeq_epi32(D, B)), _mm_andnot_si128(_mm_cmpeq_epi32(E, A), _mm_cmpeq_epi32(D, H)));
+		__m128i m2 = _mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi32(E, I), _mm_cmpeq_epi32(F, B)), _mm_andnot_si128(_mm_cmpeq_epi32(E, C), _mm_cmpeq_epi32(F, H)));
+
+		scale3x_sse2_store3(dst + 3 * i,
+			scale3x_sse2_select(_mm_andnot_si128(skip, m0), D, E),
+			E,
+			scale3x_sse2_select(_mm_andnot_si128(skip, m2), F, E));
+	}
+
+	/* remaining central pixels */
+	for (; i < count - 1; ++i) {
+		if (src0[i] != src2[i] && src1[i - 1] != src1[i + 1]) {
+			dst[3 * i] = (src1[i - 1] == src0[i] && src1[i] != src2[i - 1]) || (src1[i - 1] == src2[i] && src1[i] != src0[i - 1]) ? src1[i - 1] : src1[i];
+			dst[3 * i + 1] = src1[i];
+			dst[3 * i + 2] = (src1[i + 1] == src0[i] && src1[i] != src2[i + 1]) || (src1[i + 1] == src2[i] && src1[i] != src0[i + 1]) ? src1[i + 1] : src1[i];
+		} else {
+			dst[3 * i] = src1[i];
+			dst[3 * i + 1] = src1[i];
+			dst[3 * i + 2] = src1[i];
+		}
+	}
+
+	/* last pixel */
+	if (src0[i] != src2[i] && src1[i - 1] != src1[i]) {
+		dst[3 * i] = (src1[i - 1] == src0[i] && src1[i] != src2[i - 1]) || (src1[i - 1] == src2[i] && src1[i] != src0[i - 1]) ? src1[i - 1] : src1[i];
+		dst[3 * i + 1] = src1[i];
+		dst[3 * i + 2] = src1[i];
+	} else {
+		dst[3 * i] = src1[i];
+		dst[3 * i + 1] = src1[i];
+		dst[3 * i + 2] = src1[i];
+	}
+}
+
+/**
+ * Scale by a factor of 3 a row of pixels of 32 bits.
+ * This function operates like scale3x_32_def() but processes four source
+ * pixels per iteration with SSE2 compares and selects. The output is
+ * identical to the C version.
+ * \param src0 Pointer at the first pixel of the previous row.
+ * \param src1 Pointer at the first pixel of the current row.
+ * \param src2 Pointer at the first pixel of the next row.
+ * \param count Length in pixels of the src0, src1 and src2 rows.
+ * It must be at least 2.
+ * \param dst0 First destination row, triple length in pixels.
+ * \param dst1 Second destination row, triple length in pixels.
+ * \param dst2 Third destination row, triple length in pixels.
+ */
+void scale3x_32_sse2(scale3x_uint32* dst0, scale3x_uint32* dst1, scale3x_uint32* dst2, const scale3x_uint32* src0, const scale3x_uint32* src1, const scale3x_uint32* src2, unsigned count)
+{
+	scale3x_32_sse2_border(dst0, src0, src1, src2, count);
+	scale3x_32_sse2_center(dst1, src0, src1, src2, count);
+	scale3x_32_sse2_border(dst2, src2, src1, src0, count);
+}
+
+#endif /* USE_SSE2_INTERP_SCALE */
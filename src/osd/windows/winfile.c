@@ -322,6 +322,37 @@ done:
 }
 
 
+//============================================================
+//  osd_rename
+//============================================================
+
+file_error osd_rename(const char *oldname, const char *newname)
+{
+	file_error filerr = FILERR_NONE;
+
+	TCHAR *oldstr = tstring_from_utf8(oldname);
+	TCHAR *newstr = tstring_from_utf8(newname);
+	if (!oldstr || !newstr)
+	{
+		filerr = FILERR_OUT_OF_MEMORY;
+		goto done;
+	}
+
+	if (!MoveFileEx(oldstr, newstr, MOVEFILE_REPLACE_EXISTING))
+	{
+		filerr = win_error_to_file_error(GetLastError());
+		goto done;
+	}
+
+done:
+	if (oldstr)
+		osd_free(oldstr);
+	if (newstr)
+		osd_free(newstr);
+	return filerr;
+}
+
+
 //============================================================
 //  osd_get_physical_drive_geometry
 //============================================================
@@ -176,6 +176,54 @@ void osd_free_executable(void *ptr, size_t size)
 }
 
 
+//============================================================
+//  osd_map_file_private
+//============================================================
+
+void *osd_map_file_private(const char *path, UINT64 *length)
+{
+	TCHAR *t_path = tstring_from_utf8(path);
+	if (t_path == NULL)
+		return NULL;
+
+	HANDLE file = CreateFile(t_path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	osd_free(t_path);
+	if (file == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	DWORD upper;
+	DWORD lower = GetFileSize(file, &upper);
+	UINT64 size = ((UINT64)upper << 32) | lower;
+	if ((lower == INVALID_FILE_SIZE && GetLastError() != NO_ERROR) || size == 0)
+	{
+		CloseHandle(file);
+		return NULL;
+	}
+
+	// the view keeps the mapping object and file alive after the handles are closed
+	HANDLE mapping = CreateFileMapping(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	CloseHandle(file);
+	if (mapping == NULL)
+		return NULL;
+	void *ptr = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+	CloseHandle(mapping);
+
+	if (ptr != NULL)
+		*length = size;
+	return ptr;
+}
+
+
+//============================================================
+//  osd_unmap_file
+//============================================================
+
+void osd_unmap_file(void *ptr, UINT64 length)
+{
+	UnmapViewOfFile(ptr);
+}
+
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
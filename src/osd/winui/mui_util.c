@@ -30,6 +30,7 @@
 // MAME/MAMEUI headers
 #include "emu.h"
 #include "unzip.h"
+#include "un7z.h"
 #include "sound/samples.h"
 #include "winutf8.h"
 #include "strconv.h"
@@ -791,6 +792,7 @@ BOOL DriverUsesController(int driver_index, int type)
 void FlushFileCaches(void)
 {
 	zip_file_cache_clear();
+	_7z_file_cache_clear();
 }
 
 BOOL StringIsSuffixedBy(const char *s, const char *suffix)
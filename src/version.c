@@ -39,3 +39,7 @@
 
 extern const char build_version[];
 const char build_version[] = "0.148 UNOFFICIAL (" __DATE__ ")";
+
+/* this file is recompiled on every link, so the stamp identifies one build */
+extern const char build_stamp[];
+const char build_stamp[] = __DATE__ " " __TIME__;